@@ -0,0 +1,308 @@
+#ifndef BENCH_UTILS_HPP
+#define BENCH_UTILS_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// ============================================================================================================================
+/**
+ * @brief Minimal benchmark harness in the spirit of Google Benchmark. Every benchmark is a function, that repeats measured
+ * work while State::keepRunning returns true. Number of iterations is raised until one run takes at least the minimal time,
+ * only the last run is reported.
+ *
+ * @par
+ * Output in JSON has the same layout as output of Google Benchmark (context and array of benchmarks with real_time,
+ * cpu_time, bytes_per_second and items_per_second), so the same tools can compare two runs. Every benchmark also has dtype
+ * and shape fields.
+ *
+ * @par
+ * Arguments
+ * @par
+ * --benchmark_filter=<regex> runs only benchmarks whose name matches.
+ * @par
+ * --benchmark_min_time=<seconds> minimal time of reported run, default 0.5.
+ * @par
+ * --benchmark_format=<console|json> format of standard output.
+ * @par
+ * --benchmark_out=<file> writes JSON into the file as well.
+ */
+namespace bench{
+
+inline void doNotOptimizeAway(const void* p){
+    asm volatile("" : : "g"(p) : "memory");
+}
+
+class State{
+
+    uint64_t iterations_;
+    uint64_t remaining_;
+    bool running_ = false;
+
+    std::chrono::steady_clock::time_point realStart_;
+    std::clock_t cpuStart_ = 0;
+    double realSeconds_ = 0;
+    double cpuSeconds_ = 0;
+
+    uint64_t bytesPerIteration_ = 0;
+    uint64_t itemsPerIteration_ = 0;
+
+    public:
+
+    explicit State(const uint64_t iterations) : iterations_(iterations), remaining_(iterations){}
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Condition of the measured loop, timer starts on the first call and stops when all iterations are done.
+     *
+     * @return Bool @b true if another iteration should run.
+     */
+    bool keepRunning(){
+
+        if(!running_ && remaining_ == iterations_){
+            resumeTiming();
+        }
+
+        if(remaining_ == 0){
+            if(running_) pauseTiming();
+            return false;
+        }
+
+        --remaining_;
+        return true;
+    }
+
+    /// Stops the timer, so preparation of the next iteration is not measured.
+    void pauseTiming(){
+        realSeconds_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - realStart_).count();
+        cpuSeconds_ += static_cast<double>(std::clock() - cpuStart_) / CLOCKS_PER_SEC;
+        running_ = false;
+    }
+
+    void resumeTiming(){
+        running_ = true;
+        cpuStart_ = std::clock();
+        realStart_ = std::chrono::steady_clock::now();
+    }
+
+    void setBytesPerIteration(const uint64_t bytes){ bytesPerIteration_ = bytes; }
+    void setItemsPerIteration(const uint64_t items){ itemsPerIteration_ = items; }
+
+    uint64_t getIterations() const{ return iterations_; }
+    double getRealSeconds() const{ return realSeconds_; }
+    double getCpuSeconds() const{ return cpuSeconds_; }
+    uint64_t getBytesPerIteration() const{ return bytesPerIteration_; }
+    uint64_t getItemsPerIteration() const{ return itemsPerIteration_; }
+};
+
+struct Benchmark{
+    std::string name;
+    std::string dtype;
+    std::string shape;
+    std::function<void(State&)> function;
+};
+
+struct Result{
+    const Benchmark* benchmark;
+    uint64_t iterations;
+    double realNanoseconds;
+    double cpuNanoseconds;
+    double bytesPerSecond;
+    double itemsPerSecond;
+};
+
+inline std::vector<Benchmark>& registry(){
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+/** ---------------------------------------------------------------------------------------------------------------------------
+ * @brief Adds benchmark to the suite, name should be unique and the same between runs to be comparable.
+ *
+ * @param name full name of the benchmark, usually operation/dtype/shape.
+ * @param dtype name of the item type.
+ * @param shape dimension sizes as text.
+ * @param function body of the benchmark.
+ */
+inline void registerBenchmark(std::string name, std::string dtype, std::string shape, std::function<void(State&)> function){
+    registry().push_back(Benchmark{std::move(name), std::move(dtype), std::move(shape), std::move(function)});
+}
+
+template <class T> constexpr std::string_view typeName();
+template <> constexpr std::string_view typeName<int>(){ return "int32"; }
+template <> constexpr std::string_view typeName<int64_t>(){ return "int64"; }
+template <> constexpr std::string_view typeName<float>(){ return "float32"; }
+template <> constexpr std::string_view typeName<double>(){ return "float64"; }
+
+inline std::string shapeName(const std::vector<uint64_t>& shape){
+
+    std::string name;
+    for(uint64_t i = 0; i < shape.size(); ++i){
+        if(i > 0) name += "x";
+        name += std::to_string(shape[i]);
+    }
+    return name;
+}
+
+inline Result runBenchmark(const Benchmark& benchmark, const double minSeconds){
+
+    constexpr uint64_t maxIterations = 1'000'000'000;
+
+    uint64_t iterations = 1;
+    while(true){
+
+        State state(iterations);
+        benchmark.function(state);
+
+        const double seconds = state.getRealSeconds();
+        if(seconds >= minSeconds || iterations >= maxIterations){
+
+            const double perIteration = 1.0 / static_cast<double>(iterations);
+            const double divisor = seconds > 0 ? seconds : 1e-9;
+
+            return Result{
+                &benchmark,
+                iterations,
+                seconds * perIteration * 1e9,
+                state.getCpuSeconds() * perIteration * 1e9,
+                static_cast<double>(state.getBytesPerIteration()) * iterations / divisor,
+                static_cast<double>(state.getItemsPerIteration()) * iterations / divisor
+            };
+        }
+
+        // Aim a bit over the minimal time, but never grow more than ten times at once
+        const double multiplier = seconds > 0 ? std::clamp(minSeconds * 1.4 / seconds, 2.0, 10.0) : 10.0;
+        iterations = std::min(maxIterations, static_cast<uint64_t>(static_cast<double>(iterations) * multiplier));
+    }
+}
+
+inline std::string escapeJson(const std::string& text){
+
+    std::string escaped;
+    for(const char c : text){
+        if(c == '"' || c == '\\') escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+inline void writeJson(std::ostream& os, const std::vector<Result>& results, const std::string& executable){
+
+    const std::time_t now = std::time(nullptr);
+    char date[32];
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+#ifdef NDEBUG
+    constexpr const char* buildType = "release";
+#else
+    constexpr const char* buildType = "debug";
+#endif
+
+    os << std::setprecision(10);
+    os << "{\n";
+    os << "  \"context\": {\n";
+    os << "    \"date\": \"" << date << "\",\n";
+    os << "    \"executable\": \"" << escapeJson(executable) << "\",\n";
+    os << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+    os << "    \"library_build_type\": \"" << buildType << "\"\n";
+    os << "  },\n";
+    os << "  \"benchmarks\": [";
+
+    for(uint64_t i = 0; i < results.size(); ++i){
+
+        const Result& result = results[i];
+        os << (i == 0 ? "\n" : ",\n");
+        os << "    {\n";
+        os << "      \"name\": \"" << escapeJson(result.benchmark->name) << "\",\n";
+        os << "      \"run_name\": \"" << escapeJson(result.benchmark->name) << "\",\n";
+        os << "      \"run_type\": \"iteration\",\n";
+        os << "      \"dtype\": \"" << result.benchmark->dtype << "\",\n";
+        os << "      \"shape\": \"" << result.benchmark->shape << "\",\n";
+        os << "      \"iterations\": " << result.iterations << ",\n";
+        os << "      \"real_time\": " << result.realNanoseconds << ",\n";
+        os << "      \"cpu_time\": " << result.cpuNanoseconds << ",\n";
+        os << "      \"time_unit\": \"ns\",\n";
+        os << "      \"bytes_per_second\": " << result.bytesPerSecond << ",\n";
+        os << "      \"items_per_second\": " << result.itemsPerSecond << "\n";
+        os << "    }";
+    }
+
+    os << "\n  ]\n}\n";
+}
+
+inline void writeConsoleLine(std::ostream& os, const Result& result){
+
+    os << std::left << std::setw(56) << result.benchmark->name << std::right
+       << std::setw(14) << std::fixed << std::setprecision(0) << result.realNanoseconds << " ns"
+       << std::setw(14) << result.cpuNanoseconds << " ns"
+       << std::setw(12) << result.iterations
+       << std::setw(12) << std::setprecision(3) << result.bytesPerSecond / (1 << 30) << " GiB/s"
+       << std::setw(12) << result.itemsPerSecond / 1e6 << " M/s" << std::endl;
+}
+
+/** ---------------------------------------------------------------------------------------------------------------------------
+ * @brief Parses arguments, runs registered benchmarks and prints results.
+ *
+ * @param argc number of arguments of main.
+ * @param argv arguments of main.
+ *
+ * @return Exit code of the program.
+ */
+inline int runBenchmarks(int argc, char** argv){
+
+    std::regex filter(".*");
+    double minSeconds = 0.5;
+    bool json = false;
+    std::string outputFile;
+
+    for(int i = 1; i < argc; ++i){
+
+        const std::string argument = argv[i];
+        const auto value = [&](const std::string& prefix){ return argument.substr(prefix.size()); };
+
+        if(argument.starts_with("--benchmark_filter=")){
+            filter = std::regex(value("--benchmark_filter="));
+        }else if(argument.starts_with("--benchmark_min_time=")){
+            minSeconds = std::stod(value("--benchmark_min_time="));
+        }else if(argument.starts_with("--benchmark_format=")){
+            json = value("--benchmark_format=") == "json";
+        }else if(argument.starts_with("--benchmark_out=")){
+            outputFile = value("--benchmark_out=");
+        }else{
+            std::cerr << "Unknown argument " << argument << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<Result> results;
+    for(const Benchmark& benchmark : registry()){
+
+        if(!std::regex_search(benchmark.name, filter)) continue;
+
+        results.push_back(runBenchmark(benchmark, minSeconds));
+        if(!json) writeConsoleLine(std::cout, results.back());
+    }
+
+    if(json) writeJson(std::cout, results, argv[0]);
+
+    if(!outputFile.empty()){
+        std::ofstream file(outputFile);
+        writeJson(file, results, argv[0]);
+    }
+
+    return 0;
+}
+
+} // end bench
+
+#endif
@@ -0,0 +1,45 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "core/Matrix.hpp"
+#include "BenchUtils.hpp"
+
+using gema::Matrix;
+
+namespace{
+
+const std::vector<uint64_t> sizes{128, 256, 512};
+
+// Items per second of square multiplication are floating point operations, 2 * size^3 per product
+template <class T>
+void registerMatrixBenchmarks(){
+
+    const std::string dtype(bench::typeName<T>());
+
+    for(const uint64_t size : sizes){
+
+        const std::string shape = bench::shapeName({size, size});
+
+        bench::registerBenchmark("Matrix/matrixMultiplication/" + dtype + "/" + shape, dtype, shape, [=](bench::State& state){
+            auto matrix = Matrix<T>(size, size);
+            auto matrix2 = Matrix<T>(size, size);
+            matrix.fillWith(T{1});
+            matrix2.fillWith(T{2});
+            while(state.keepRunning()){
+                auto product = matrix.matrixMultiplicationAndReturn(matrix2);
+                bench::doNotOptimizeAway(product.getData());
+            }
+            state.setBytesPerIteration(3 * size * size * sizeof(T));
+            state.setItemsPerIteration(2 * size * size * size);
+        });
+    }
+}
+
+const bool registered = [](){
+    registerMatrixBenchmarks<float>();
+    registerMatrixBenchmarks<double>();
+    return true;
+}();
+
+}
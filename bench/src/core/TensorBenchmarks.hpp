@@ -0,0 +1,376 @@
+#ifndef TENSOR_BENCHMARKS_HPP
+#define TENSOR_BENCHMARKS_HPP
+
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "core/LinearContainer.hpp"
+#include "BenchUtils.hpp"
+
+namespace bench{
+
+// Kernels of TensorParallel run asynchronously, so the measured work must end by waiting for them
+template <class TensorT>
+void finish(const TensorT& tensor){
+    if constexpr (requires { tensor.sync(); }){
+        tensor.sync();
+    }
+}
+
+inline gema::LinearContainer<uint64_t> toDimensionSizes(const std::vector<uint64_t>& shape){
+
+    gema::LinearContainer<uint64_t> dimensionSizes;
+    for(const uint64_t size : shape){
+        dimensionSizes.push_back(size);
+    }
+    return dimensionSizes;
+}
+
+inline uint64_t countItems(const std::vector<uint64_t>& shape){
+
+    uint64_t count = 1;
+    for(const uint64_t size : shape){
+        count *= size;
+    }
+    return count;
+}
+
+// Tensor of given shape with small items, that keep arithmetic away from overflows and denormals
+template <class TensorT>
+TensorT makeTensor(const std::vector<uint64_t>& shape){
+
+    using T = typename TensorT::value_type;
+
+    const uint64_t itemCount = countItems(shape);
+    gema::LinearContainer<T> items(itemCount);
+    for(uint64_t i = 0; i < itemCount; ++i){
+        items[i] = static_cast<T>(i % 97 + 1);
+    }
+
+    return TensorT(toDimensionSizes(shape), items);
+}
+
+// Walks all coordinates of the shape in ascending order, like nested loops would
+template <typename F>
+void forEachCoordinates(const std::vector<uint64_t>& shape, F&& function){
+
+    std::vector<uint64_t> coordinates(shape.size(), 0);
+    const uint64_t itemCount = countItems(shape);
+
+    for(uint64_t i = 0; i < itemCount; ++i){
+
+        function(coordinates);
+
+        for(uint64_t d = shape.size(); d-- > 0;){
+            if(++coordinates[d] < shape[d]) break;
+            coordinates[d] = 0;
+        }
+    }
+}
+
+/** ---------------------------------------------------------------------------------------------------------------------------
+ * @brief Registers benchmarks of operations common to Tensor and TensorParallel for one item type.
+ *
+ * @param prefix first part of names of the benchmarks.
+ * @param shapes shapes of bulk operations.
+ * @param smallShapes shapes of operations working by single items, which are much slower per item.
+ */
+template <class TensorT>
+void registerTensorBenchmarks(const std::string& prefix, const std::vector<std::vector<uint64_t>>& shapes,
+const std::vector<std::vector<uint64_t>>& smallShapes){
+
+    using T = typename TensorT::value_type;
+
+    const std::string dtype(typeName<T>());
+
+    const auto add = [&](const std::string& operation, const std::vector<uint64_t>& shape, std::function<void(State&)> body){
+        const std::string shapeText = shapeName(shape);
+        registerBenchmark(prefix + "/" + operation + "/" + dtype + "/" + shapeText, dtype, shapeText, std::move(body));
+    };
+
+    for(const std::vector<uint64_t>& shape : shapes){
+
+        const uint64_t itemCount = countItems(shape);
+        const uint64_t bytes = itemCount * sizeof(T);
+        const uint64_t lastDimension = shape.size() - 1;
+
+        add("construction", shape, [=](State& state){
+            const gema::LinearContainer<uint64_t> dimensionSizes = toDimensionSizes(shape);
+            while(state.keepRunning()){
+                TensorT tensor(dimensionSizes);
+                finish(tensor);
+                doNotOptimizeAway(&tensor);
+            }
+            state.setBytesPerIteration(bytes);
+            state.setItemsPerIteration(itemCount);
+        });
+
+        add("add", shape, [=](State& state){
+            const TensorT tensor1 = makeTensor<TensorT>(shape);
+            const TensorT tensor2 = makeTensor<TensorT>(shape);
+            while(state.keepRunning()){
+                TensorT result = tensor1 + tensor2;
+                finish(result);
+                doNotOptimizeAway(&result);
+            }
+            state.setBytesPerIteration(3 * bytes);
+            state.setItemsPerIteration(itemCount);
+        });
+
+        add("multiply", shape, [=](State& state){
+            const TensorT tensor1 = makeTensor<TensorT>(shape);
+            const TensorT tensor2 = makeTensor<TensorT>(shape);
+            while(state.keepRunning()){
+                TensorT result = tensor1 * tensor2;
+                finish(result);
+                doNotOptimizeAway(&result);
+            }
+            state.setBytesPerIteration(3 * bytes);
+            state.setItemsPerIteration(itemCount);
+        });
+
+        add("forEachAndReturn", shape, [=](State& state){
+            const TensorT tensor = makeTensor<TensorT>(shape);
+            while(state.keepRunning()){
+                auto result = tensor.forEachAndReturn([](const T& item){ return item * static_cast<T>(3); });
+                finish(result);
+                doNotOptimizeAway(&result);
+            }
+            state.setBytesPerIteration(2 * bytes);
+            state.setItemsPerIteration(itemCount);
+        });
+
+        if(shape.size() >= 2){
+            add("transposition", shape, [=](State& state){
+                const TensorT tensor = makeTensor<TensorT>(shape);
+                while(state.keepRunning()){
+                    TensorT result = tensor.transpositionAndReturn(0, lastDimension);
+                    finish(result);
+                    doNotOptimizeAway(&result);
+                }
+                state.setBytesPerIteration(2 * bytes);
+                state.setItemsPerIteration(itemCount);
+            });
+        }
+
+        // Changes of dimensions modify the tensor, so every iteration gets fresh copy outside of the measured time
+        add("resize", shape, [=](State& state){
+            const TensorT original = makeTensor<TensorT>(shape);
+            std::vector<uint64_t> newShape = shape;
+            ++newShape[lastDimension];
+            const gema::LinearContainer<uint64_t> newDimensionSizes = toDimensionSizes(newShape);
+            while(state.keepRunning()){
+                state.pauseTiming();
+                TensorT tensor = original;
+                finish(tensor);
+                state.resumeTiming();
+                tensor.resize(newDimensionSizes);
+                finish(tensor);
+                doNotOptimizeAway(&tensor);
+            }
+            state.setBytesPerIteration(bytes + countItems(newShape) * sizeof(T));
+            state.setItemsPerIteration(itemCount);
+        });
+
+        add("addDimension", shape, [=](State& state){
+            const TensorT original = makeTensor<TensorT>(shape);
+            while(state.keepRunning()){
+                state.pauseTiming();
+                TensorT tensor = original;
+                finish(tensor);
+                state.resumeTiming();
+                tensor.addDimension(2, 0);
+                finish(tensor);
+                doNotOptimizeAway(&tensor);
+            }
+            state.setBytesPerIteration(3 * bytes);
+            state.setItemsPerIteration(itemCount);
+        });
+
+        add("removeDimension", shape, [=](State& state){
+            std::vector<uint64_t> biggerShape = shape;
+            biggerShape.push_back(2);
+            const TensorT original = makeTensor<TensorT>(biggerShape);
+            const uint64_t removedDimension = biggerShape.size() - 1;
+            while(state.keepRunning()){
+                state.pauseTiming();
+                TensorT tensor = original;
+                finish(tensor);
+                state.resumeTiming();
+                tensor.removeDimension(removedDimension);
+                finish(tensor);
+                doNotOptimizeAway(&tensor);
+            }
+            state.setBytesPerIteration(3 * bytes);
+            state.setItemsPerIteration(itemCount);
+        });
+
+        // Equal tensors, so all items are compared
+        add("equals", shape, [=](State& state){
+            const TensorT tensor1 = makeTensor<TensorT>(shape);
+            const TensorT tensor2 = makeTensor<TensorT>(shape);
+            while(state.keepRunning()){
+                const bool result = tensor1 == tensor2;
+                doNotOptimizeAway(&result);
+            }
+            state.setBytesPerIteration(2 * bytes);
+            state.setItemsPerIteration(itemCount);
+        });
+
+        if constexpr (requires(const TensorT& tensor){ tensor <=> tensor; }){
+            add("threeWayComparison", shape, [=](State& state){
+                const TensorT tensor1 = makeTensor<TensorT>(shape);
+                const TensorT tensor2 = makeTensor<TensorT>(shape);
+                while(state.keepRunning()){
+                    const auto result = tensor1 <=> tensor2;
+                    doNotOptimizeAway(&result);
+                }
+                state.setBytesPerIteration(2 * bytes);
+                state.setItemsPerIteration(itemCount);
+            });
+        }
+    }
+
+    for(const std::vector<uint64_t>& shape : smallShapes){
+
+        const uint64_t itemCount = countItems(shape);
+        const uint64_t bytes = itemCount * sizeof(T);
+
+        // Bytes are the length of the produced text
+        add("toString", shape, [=](State& state){
+            const TensorT tensor = makeTensor<TensorT>(shape);
+            uint64_t length = 0;
+            while(state.keepRunning()){
+                const std::string text = tensor.toString();
+                length = text.size();
+                doNotOptimizeAway(text.data());
+            }
+            state.setBytesPerIteration(length);
+            state.setItemsPerIteration(itemCount);
+        });
+
+        add("getItem", shape, [=](State& state){
+            TensorT tensor = makeTensor<TensorT>(shape);
+            while(state.keepRunning()){
+                T sum{};
+                forEachCoordinates(shape, [&](const std::vector<uint64_t>& coordinates){
+                    sum += tensor.getItem(coordinates);
+                });
+                doNotOptimizeAway(&sum);
+            }
+            state.setBytesPerIteration(bytes);
+            state.setItemsPerIteration(itemCount);
+        });
+
+        add("setItem", shape, [=](State& state){
+            TensorT tensor = makeTensor<TensorT>(shape);
+            while(state.keepRunning()){
+                forEachCoordinates(shape, [&](const std::vector<uint64_t>& coordinates){
+                    tensor.setItem(static_cast<T>(coordinates[0]), coordinates);
+                });
+                finish(tensor);
+                doNotOptimizeAway(&tensor);
+            }
+            state.setBytesPerIteration(bytes);
+            state.setItemsPerIteration(itemCount);
+        });
+
+        // Batched access of the same items as getItem and setItem above
+        if constexpr (requires(TensorT& tensor, const std::vector<uint64_t>& list){ tensor.getItems(list); }){
+
+            std::vector<uint64_t> coordinatesList;
+            forEachCoordinates(shape, [&](const std::vector<uint64_t>& coordinates){
+                coordinatesList.insert(coordinatesList.end(), coordinates.begin(), coordinates.end());
+            });
+
+            add("getItems", shape, [=](State& state){
+                TensorT tensor = makeTensor<TensorT>(shape);
+                while(state.keepRunning()){
+                    const auto items = tensor.getItems(coordinatesList);
+                    doNotOptimizeAway(&items);
+                }
+                state.setBytesPerIteration(bytes);
+                state.setItemsPerIteration(itemCount);
+            });
+
+            add("setItems", shape, [=](State& state){
+                TensorT tensor = makeTensor<TensorT>(shape);
+                const std::vector<T> values(itemCount, static_cast<T>(1));
+                while(state.keepRunning()){
+                    tensor.setItems(coordinatesList, values);
+                    finish(tensor);
+                    doNotOptimizeAway(&tensor);
+                }
+                state.setBytesPerIteration(bytes);
+                state.setItemsPerIteration(itemCount);
+            });
+        }
+    }
+}
+
+/** ---------------------------------------------------------------------------------------------------------------------------
+ * @brief Registers benchmarks of construction and item access of tensors with many dimensions, where the cost of metadata
+ * is visible next to the cost of items.
+ *
+ * @param prefix first part of names of the benchmarks.
+ * @param shapes shapes of the tensors, usually of high rank or of one long dimension.
+ * @param walkCount number of items read by getItemWalk in ascending coordinates, zero skips the benchmark.
+ */
+template <class TensorT>
+void registerRankBenchmarks(const std::string& prefix, const std::vector<std::vector<uint64_t>>& shapes,
+const uint64_t walkCount){
+
+    using T = typename TensorT::value_type;
+
+    const std::string dtype(typeName<T>());
+
+    const auto add = [&](const std::string& operation, const std::vector<uint64_t>& shape, std::function<void(State&)> body){
+        const std::string shapeText = shapeName(shape);
+        registerBenchmark(prefix + "/" + operation + "/" + dtype + "/" + shapeText, dtype, shapeText, std::move(body));
+    };
+
+    for(const std::vector<uint64_t>& shape : shapes){
+
+        const uint64_t itemCount = countItems(shape);
+
+        add("rankConstruction", shape, [=](State& state){
+            const gema::LinearContainer<uint64_t> dimensionSizes = toDimensionSizes(shape);
+            while(state.keepRunning()){
+                TensorT tensor(dimensionSizes);
+                finish(tensor);
+                doNotOptimizeAway(&tensor);
+            }
+            state.setBytesPerIteration(itemCount * sizeof(T));
+            state.setItemsPerIteration(itemCount);
+        });
+
+        if(walkCount == 0) continue;
+
+        const uint64_t count = std::min(walkCount, itemCount);
+
+        add("getItemWalk", shape, [=](State& state){
+            TensorT tensor(toDimensionSizes(shape));
+            while(state.keepRunning()){
+                std::vector<uint64_t> coordinates(shape.size(), 0);
+                T sum{};
+                for(uint64_t i = 0; i < count; ++i){
+                    sum += tensor.getItem(coordinates);
+                    for(uint64_t d = shape.size(); d-- > 0;){
+                        if(++coordinates[d] < shape[d]) break;
+                        coordinates[d] = 0;
+                    }
+                }
+                doNotOptimizeAway(&sum);
+            }
+            state.setBytesPerIteration(count * sizeof(T));
+            state.setItemsPerIteration(count);
+        });
+    }
+}
+
+} // end bench
+
+#endif
@@ -0,0 +1,24 @@
+#include <cstdint>
+#include <vector>
+
+#include "core/TensorParallel.hpp"
+#include "TensorBenchmarks.hpp"
+
+using gema::TensorParallel;
+
+namespace{
+
+const std::vector<std::vector<uint64_t>> shapes{{1 << 20}, {1024, 1024}, {32, 32, 32, 32}};
+// Every getItem and setItem of TensorParallel is a copy between host and device
+const std::vector<std::vector<uint64_t>> smallShapes{{64, 64}};
+const std::vector<std::vector<uint64_t>> rankShapes{std::vector<uint64_t>(16, 2)};
+
+const bool registered = [](){
+    bench::registerTensorBenchmarks<TensorParallel<int>>("TensorParallel", shapes, smallShapes);
+    bench::registerTensorBenchmarks<TensorParallel<float>>("TensorParallel", shapes, smallShapes);
+    bench::registerTensorBenchmarks<TensorParallel<double>>("TensorParallel", shapes, smallShapes);
+    bench::registerRankBenchmarks<TensorParallel<int>>("TensorParallel", rankShapes, 0);
+    return true;
+}();
+
+}
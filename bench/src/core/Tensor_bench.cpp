@@ -0,0 +1,27 @@
+#include <cstdint>
+#include <vector>
+
+#include "core/Tensor.hpp"
+#include "TensorBenchmarks.hpp"
+
+using gema::Tensor;
+
+namespace{
+
+const std::vector<std::vector<uint64_t>> shapes{{1 << 20}, {1024, 1024}, {32, 32, 32, 32}};
+const std::vector<std::vector<uint64_t>> smallShapes{{64, 64}, {16, 16, 16}};
+const std::vector<std::vector<uint64_t>> rankShapes{
+    std::vector<uint64_t>(16, 2), std::vector<uint64_t>(17, 2), std::vector<uint64_t>(18, 2), std::vector<uint64_t>(24, 2),
+    {256 * 256}, {256 * 256 * 2}, {256 * 256 * 4}, {256, 256, 256}
+};
+constexpr uint64_t walkCount = 1 << 20;
+
+const bool registered = [](){
+    bench::registerTensorBenchmarks<Tensor<int>>("Tensor", shapes, smallShapes);
+    bench::registerTensorBenchmarks<Tensor<float>>("Tensor", shapes, smallShapes);
+    bench::registerTensorBenchmarks<Tensor<double>>("Tensor", shapes, smallShapes);
+    bench::registerRankBenchmarks<Tensor<int>>("Tensor", rankShapes, walkCount);
+    return true;
+}();
+
+}
@@ -0,0 +1,5 @@
+#include "core/BenchUtils.hpp"
+
+int main(int argc, char** argv){
+    return bench::runBenchmarks(argc, argv);
+}
@@ -1,6 +1,8 @@
 #ifndef ABSTRACT_OPERATION_HPP
 #define ABSTRACT_OPERATION_HPP
 
+#include "TensorExpression.hpp"
+
 namespace gema {
 
     
@@ -13,14 +15,18 @@ class AbstractOperation {
 
     public:
 
+    // Non-assigning operators do not compute anything, they build lazy expression (see TensorExpression.hpp), which is
+    // evaluated in one fused loop once it is assigned to tensor. Assigning operators are evaluated immediately. Operations
+    // of operators keep no state, so they always allow ExecutionPolicy::parallel.
+
     #define ARITHMETIC_BINARY_ToTrT(OP_SYMBOL)\
     /**/\
         template<typename D = Derived>\
         friend auto operator OP_SYMBOL(const Derived& tensor1, const Derived& tensor2)\
         requires requires (T<D> a, T<D> b) {a OP_SYMBOL b;}{\
     /**/\
-            return tensor1.applyAndReturn(tensor1, tensor2, [](const T<D>& tensorItem, const T<D>& tensor2Item){\
-                    return tensorItem OP_SYMBOL tensor2Item;\
+            return make_binary_expression(tensor1, tensor2, [](const auto& tensorItem, const auto& tensor2Item) -> decltype(materialize_expression(tensorItem OP_SYMBOL tensor2Item)){\
+                    return materialize_expression(tensorItem OP_SYMBOL tensor2Item);\
             });\
         }\
     /**/
@@ -31,8 +37,8 @@ class AbstractOperation {
         inline friend auto operator OP_SYMBOL(const Derived& tensor, const T<D>& value)\
         requires requires (T<D> a, T<D> b) {a OP_SYMBOL b;}{\
     /**/\
-            return Derived::forEachAndReturn(tensor, [value](const T<D>& item){\
-                return item OP_SYMBOL value;\
+            return make_binary_expression(tensor, value, [](const auto& item, const auto& value) -> decltype(materialize_expression(item OP_SYMBOL value)){\
+                return materialize_expression(item OP_SYMBOL value);\
             });\
         }\
     /**/
@@ -45,8 +51,8 @@ class AbstractOperation {
     /**/\
             /* Do not delegate switched argument operator! While on numbers set the operation would be often commutative, */\
             /* it is not guaranteed to be so on every type and operation!*/\
-            return Derived::forEachAndReturn(tensor, [value](const T<D>& item){\
-                return value OP_SYMBOL item;\
+            return make_binary_expression(value, tensor, [](const auto& value, const auto& item) -> decltype(materialize_expression(value OP_SYMBOL item)){\
+                return materialize_expression(value OP_SYMBOL item);\
             });\
         }\
     /**/
@@ -59,7 +65,7 @@ class AbstractOperation {
     /**/\
             tensor1.apply(tensor2, [](T<D>& tensorItem, const T<D>& tensor2Item){\
                 tensorItem OP_SYMBOL##= tensor2Item;\
-            });\
+            }, ExecutionPolicy::parallel);\
         }\
     /**/
 
@@ -71,7 +77,7 @@ class AbstractOperation {
     /**/\
             tensor.forEach([value](T<D>& item){\
                 item OP_SYMBOL##= value;\
-            });\
+            }, ExecutionPolicy::parallel);\
         }\
     /**/
 
@@ -128,8 +134,8 @@ class AbstractOperation {
         auto operator OP_SYMBOL() const\
         requires requires (T<D> a) {OP_SYMBOL a;}{\
     /**/\
-            return self().forEachAndReturn([](const T<D>& item){\
-                return OP_SYMBOL item;\
+            return make_unary_expression(self(), [](const auto& item) -> decltype(materialize_expression(OP_SYMBOL item)){\
+                return materialize_expression(OP_SYMBOL item);\
             });\
         }\
     /**/
@@ -148,7 +154,7 @@ class AbstractOperation {
         void OP_NAME##InPlace(){\
             self().forEach([](T<D>& item){\
                 item = OP_SYMBOL item;\
-            });\
+            }, ExecutionPolicy::parallel);\
         }
 
     UNARY_OPERATION_INPLACE(~, complement)
@@ -165,7 +171,7 @@ class AbstractOperation {
     /**/\
             self().forEach([](T<D>& item){\
                 OP_SYMBOL item;\
-            });\
+            }, ExecutionPolicy::parallel);\
     /**/\
             return *this;\
         }\
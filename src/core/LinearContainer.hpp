@@ -1,19 +1,57 @@
 #ifndef LINEAR_CONTAINER_HPP
 #define LINEAR_CONTAINER_HPP
 
+#include <cstddef>
 #include <memory>
+#include <type_traits>
 
 #include "MemoryBackend.hpp"
 #include "MemoryBackendConcept.hpp"
 
 namespace gema{
 
+// Raw memory for items kept inside of the container object, empty when there is no such memory
+template <class T, size_t Capacity>
+struct InlineStorage{
+
+    alignas(T) unsigned char bytes_[Capacity * sizeof(T)];
+
+    T* data(){ return reinterpret_cast<T*>(bytes_); }
+    const T* data() const { return reinterpret_cast<const T*>(bytes_); }
+};
+
+template <class T>
+struct InlineStorage<T, 0>{
+
+    T* data(){ return nullptr; }
+    const T* data() const { return nullptr; }
+};
+
+/**
+ * @brief Contiguous container of items allocated by memory backend.
+ *
+ * @par
+ * With nonzero InlineCapacity, up to that many items are stored inside of the container object itself and the backend
+ * allocates only when the container grows above it. Inline items are in host memory, so only backends whose memory
+ * is accessible from host (host or shared USM) are meaningful with it. Used for tensor metadata, which has just a few
+ * items, but is created with every tensor.
+ *
+ * @tparam T type of items, must be trivially copyable when InlineCapacity is nonzero.
+ * @tparam IMemoryBackend backend allocating and working with the items.
+ * @tparam InlineCapacity number of items that fit into the container without allocation.
+ */
 template<class T,
-         MemoryBackendConcept<T> IMemoryBackend = MemoryBackend<T>//,
+         MemoryBackendConcept<T> IMemoryBackend = MemoryBackend<T>,
+         size_t InlineCapacity = 0//,
          //class A = AlignedAllocator<T, 64>/*std::allocator<T>*/
 >
 class LinearContainer{
 
+    static_assert(InlineCapacity == 0 || std::is_trivially_copyable_v<T>);
+
+    template <class U, MemoryBackendConcept<U> IOtherMemoryBackend, size_t OtherCapacity>
+    friend class LinearContainer;
+
 public:
 
     using value_type = T;
@@ -28,9 +66,11 @@ private:
     // size_t size_ = 0;
     // size_t capacity_ = 0;
 
-    T* begin_ = nullptr;
-    T* end_   = nullptr;
-    T* capEnd_= nullptr;
+    [[no_unique_address]] InlineStorage<T, InlineCapacity> inline_;
+
+    T* begin_ = inline_.data();
+    T* end_   = begin_;
+    T* capEnd_= begin_ + InlineCapacity;
 
     IMemoryBackend memoryBackend_;
 
@@ -52,11 +92,15 @@ public:
     template<MemoryBackendConcept<T> IOtherMemoryBackend>
     LinearContainer(const LinearContainer<T, IOtherMemoryBackend>& other, const IMemoryBackend& memoryBackend);
 
-    LinearContainer(const LinearContainer<T, IMemoryBackend>& other);
-    LinearContainer(LinearContainer<T, IMemoryBackend>&& other) noexcept;
+    LinearContainer(const LinearContainer<T, IMemoryBackend, InlineCapacity>& other);
+    LinearContainer(LinearContainer<T, IMemoryBackend, InlineCapacity>&& other) noexcept;
+
+    // Containers differing only in inline capacity hold the same items, so they convert into each other
+    template <size_t OtherCapacity>
+    LinearContainer(const LinearContainer<T, IMemoryBackend, OtherCapacity>& other) requires (OtherCapacity != InlineCapacity);
 
-    LinearContainer<T, IMemoryBackend>& operator=(const LinearContainer<T, IMemoryBackend>& other);
-    LinearContainer<T, IMemoryBackend>& operator=(LinearContainer<T, IMemoryBackend>&& other) noexcept;
+    LinearContainer<T, IMemoryBackend, InlineCapacity>& operator=(const LinearContainer<T, IMemoryBackend, InlineCapacity>& other);
+    LinearContainer<T, IMemoryBackend, InlineCapacity>& operator=(LinearContainer<T, IMemoryBackend, InlineCapacity>&& other) noexcept;
 
     operator std::span<T>();
     operator std::span<const T>() const;
@@ -83,7 +127,7 @@ public:
 
     void push_back(const T& value);
     void pop_back();
-    void swap(LinearContainer<T, IMemoryBackend>& other) noexcept;
+    void swap(LinearContainer<T, IMemoryBackend, InlineCapacity>& other) noexcept;
     iterator insert(iterator pos, const T& value);
     iterator erase(iterator pos);
     
@@ -94,8 +138,12 @@ public:
     template<class I> void assign(I first, I last);
     void assign(std::initializer_list<T> ilist);
 
-    bool operator==(const LinearContainer<T, IMemoryBackend>& other) const;
-    std::partial_ordering operator<=>(const LinearContainer<T, IMemoryBackend>& other) const;
+    bool operator==(const LinearContainer<T, IMemoryBackend, InlineCapacity>& other) const;
+    std::partial_ordering operator<=>(const LinearContainer<T, IMemoryBackend, InlineCapacity>& other) const;
+
+    template <size_t OtherCapacity>
+    bool operator==(const LinearContainer<T, IMemoryBackend, OtherCapacity>& other) const 
+    requires (OtherCapacity != InlineCapacity);
 
     T& operator[](size_t i);
     const T& operator[](size_t i) const;
@@ -127,6 +175,11 @@ public:
 
 private:
 
+    bool isInline() const;
+
+    // Takes items of other container, which is left empty, this container must not hold allocated memory
+    void takeItems(LinearContainer<T, IMemoryBackend, InlineCapacity>& other) noexcept;
+
     void push_back_slow(const T &value);
     void fastFill(T* dst, size_t count, const T &value);
 };
@@ -7,32 +7,32 @@
 
 namespace gema{
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>::LinearContainer() 
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::LinearContainer() 
     requires std::default_initializable<IMemoryBackend> {
 
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>::LinearContainer(const IMemoryBackend& memoryBackend)
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::LinearContainer(const IMemoryBackend& memoryBackend)
     : memoryBackend_(memoryBackend){
 
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>::LinearContainer(size_t n) 
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::LinearContainer(size_t n) 
     requires std::default_initializable<IMemoryBackend>{
         resize(n);
     }
 
-    template <class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>::LinearContainer(size_t n, const IMemoryBackend& memoryBackend)
+    template <class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::LinearContainer(size_t n, const IMemoryBackend& memoryBackend)
     : memoryBackend_(memoryBackend){
         resize(n);
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>::LinearContainer(std::initializer_list<T> init) 
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::LinearContainer(std::initializer_list<T> init) 
     requires std::default_initializable<IMemoryBackend> {
 
         size_t initSize = init.size();
@@ -43,8 +43,8 @@ namespace gema{
         end_ = begin_ + initSize;
     }
 
-    // template <class T, MemoryBackendConcept<T> IMemoryBackend>
-    // LinearContainer<T, IMemoryBackend>::LinearContainer(std::span<const T> s, const IMemoryBackend& memoryBackend)
+    // template <class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    // LinearContainer<T, IMemoryBackend, InlineCapacity>::LinearContainer(std::span<const T> s, const IMemoryBackend& memoryBackend)
     // : memoryBackend_(memoryBackend){
     //     size_t initSize = s.size();
     //     reserve(initSize);
@@ -54,9 +54,9 @@ namespace gema{
     //     end_ = begin_ + initSize;
     // }
     
-    template <class T, MemoryBackendConcept<T> IMemoryBackend>
+    template <class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
     template <MemoryBackendConcept<T> IOtherMemoryBackend>
-    LinearContainer<T, IMemoryBackend>::LinearContainer
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::LinearContainer
     (const LinearContainer<T, IOtherMemoryBackend>& other, const IMemoryBackend& memoryBackend)
     : memoryBackend_(memoryBackend){
 
@@ -68,9 +68,9 @@ namespace gema{
         end_ = begin_ + otherSize;
     }
 
-    template <class T, MemoryBackendConcept<T> IMemoryBackend>
+    template <class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
     template <MemoryBackendConcept<T> DestBackend>
-    LinearContainer<T, DestBackend> LinearContainer<T, IMemoryBackend>::copyToBackend(const DestBackend& destBackend) const {
+    LinearContainer<T, DestBackend> LinearContainer<T, IMemoryBackend, InlineCapacity>::copyToBackend(const DestBackend& destBackend) const {
 
         LinearContainer<T, DestBackend> destContainer(size(), destBackend);
 
@@ -79,8 +79,8 @@ namespace gema{
         return destContainer;
     }
 
-    // template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    // LinearContainer<T, IMemoryBackend>::LinearContainer(const std::vector<T>& init)
+    // template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    // LinearContainer<T, IMemoryBackend, InlineCapacity>::LinearContainer(const std::vector<T>& init)
     // requires std::default_initializable<IMemoryBackend> {
 
     //     size_t initSize = init.size();
@@ -91,8 +91,8 @@ namespace gema{
     //     end_ = begin_ + initSize;
     // }
 
-    // template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    // LinearContainer<T, IMemoryBackend>::LinearContainer(std::span<const T> s)
+    // template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    // LinearContainer<T, IMemoryBackend, InlineCapacity>::LinearContainer(std::span<const T> s)
     // requires std::default_initializable<IMemoryBackend>{
 
     //     size_t spanSize = s.size();
@@ -102,16 +102,16 @@ namespace gema{
     //     end_ = begin_ + spanSize;
     // }
 
-    // template <class T, MemoryBackendConcept<T> IMemoryBackend>
-    // LinearContainer<T, IMemoryBackend>::LinearContainer(std::span<const T> s, const IMemoryBackend& memoryBackend)
+    // template <class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    // LinearContainer<T, IMemoryBackend, InlineCapacity>::LinearContainer(std::span<const T> s, const IMemoryBackend& memoryBackend)
     // : memoryBackend_(memoryBackend){
     //     reserve(s.size());
     //     memoryBackend_.uninitialized_copy(s.data(), s.data() + s.size(), begin_);
     //     end_ = begin_ + s.size();
     // }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>::LinearContainer(const LinearContainer<T, IMemoryBackend>& other) 
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::LinearContainer(const LinearContainer<T, IMemoryBackend, InlineCapacity>& other) 
     : memoryBackend_(other.memoryBackend_){
 
         size_t otherSize = other.size();
@@ -122,21 +122,30 @@ namespace gema{
         end_ = begin_ + otherSize;
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>::LinearContainer(LinearContainer<T, IMemoryBackend>&& other) noexcept 
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::LinearContainer(LinearContainer<T, IMemoryBackend, InlineCapacity>&& other) noexcept 
     : memoryBackend_(std::move(other.memoryBackend_)){
         //swap(other);
+        takeItems(other);
+    }
 
-        begin_  = other.begin_;
-        end_    = other.end_;
-        capEnd_ = other.capEnd_;
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    template <size_t OtherCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::LinearContainer
+    (const LinearContainer<T, IMemoryBackend, OtherCapacity>& other) requires (OtherCapacity != InlineCapacity)
+    : memoryBackend_(other.memoryBackend_){
 
-        other.begin_ = other.end_ = other.capEnd_ = nullptr;
+        size_t otherSize = other.size();
+        reserve(otherSize);
+
+        memoryBackend_.uninitialized_copy(other.begin_, other.begin_ + otherSize, begin_);
+
+        end_ = begin_ + otherSize;
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>& LinearContainer<T, IMemoryBackend>::operator=
-    (const LinearContainer<T, IMemoryBackend>& other) {
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>& LinearContainer<T, IMemoryBackend, InlineCapacity>::operator=
+    (const LinearContainer<T, IMemoryBackend, InlineCapacity>& other) {
 
         if(this == &other) return *this;
         
@@ -160,52 +169,52 @@ namespace gema{
         return *this;
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>& LinearContainer<T, IMemoryBackend>::operator=
-    (LinearContainer<T, IMemoryBackend>&& other) noexcept {
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>& LinearContainer<T, IMemoryBackend, InlineCapacity>::operator=
+    (LinearContainer<T, IMemoryBackend, InlineCapacity>&& other) noexcept {
         swap(other);
         std::swap(memoryBackend_, other.memoryBackend_);
         //memoryBackend_ = std::move(other.memoryBackend_);
         return *this;
     }
 
-    template <class T, MemoryBackendConcept<T> IMemoryBackend>
-    void LinearContainer<T, IMemoryBackend>::set(const uint64_t index, const T& value){
+    template <class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    void LinearContainer<T, IMemoryBackend, InlineCapacity>::set(const uint64_t index, const T& value){
         memoryBackend_.set_value(begin_, index, value);
     }
 
-    template <class T, MemoryBackendConcept<T> IMemoryBackend>
-    T LinearContainer<T, IMemoryBackend>::get(const uint64_t index) const {
+    template <class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    T LinearContainer<T, IMemoryBackend, InlineCapacity>::get(const uint64_t index) const {
         return memoryBackend_.get_value(begin_, index);
     }
 
-    template <class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>::operator std::span<T>(){
+    template <class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::operator std::span<T>(){
         return std::span<T>(begin_, end_);
     }
 
-    template <class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>::operator std::span<const T>() const{
+    template <class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::operator std::span<const T>() const{
         return std::span<const T>(begin_, end_);
     }
 
-    // template <class T, MemoryBackendConcept<T> IMemoryBackend>
-    // LinearContainer<T, IMemoryBackend>::operator std::vector<T>() const {
+    // template <class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    // LinearContainer<T, IMemoryBackend, InlineCapacity>::operator std::vector<T>() const {
     //     return std::vector(begin_, end_);
     // }
 
-    template <class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>::~LinearContainer(){
+    template <class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::~LinearContainer(){
         clear();
     }
 
-    template <class T, MemoryBackendConcept<T> IMemoryBackend>
-    IMemoryBackend LinearContainer<T, IMemoryBackend>::getMemoryBackend() const {
+    template <class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    IMemoryBackend LinearContainer<T, IMemoryBackend, InlineCapacity>::getMemoryBackend() const {
         return memoryBackend_;
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    void LinearContainer<T, IMemoryBackend>::reserve(size_t n) {
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    void LinearContainer<T, IMemoryBackend, InlineCapacity>::reserve(size_t n) {
 
         if (n <= capacity())[[unlikely]] return;
 
@@ -224,7 +233,9 @@ namespace gema{
             }
 
             //std::allocator_traits<A>::deallocate(alloc_, oldBegin, capacity());
-            memoryBackend_.deallocate(begin_, capacity());
+            if(!isInline()){
+                memoryBackend_.deallocate(begin_, capacity());
+            }
         }
 
         begin_ = newData;
@@ -232,8 +243,8 @@ namespace gema{
         capEnd_= newData + n;
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    void LinearContainer<T, IMemoryBackend>::resize(size_t n) {
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    void LinearContainer<T, IMemoryBackend, InlineCapacity>::resize(size_t n) {
 
         size_t oldSize = size();
 
@@ -255,10 +266,10 @@ namespace gema{
         end_ = begin_ + n;
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    void LinearContainer<T, IMemoryBackend>::clear() {
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    void LinearContainer<T, IMemoryBackend, InlineCapacity>::clear() {
 
-        if(begin_) {
+        if(begin_ && !isInline()) {
             if constexpr(!std::is_trivially_destructible_v<T>) {
                 memoryBackend_.destroy(begin_, end_);
             }
@@ -267,11 +278,12 @@ namespace gema{
             memoryBackend_.deallocate(begin_, capacity());
         }
 
-        begin_ = end_ = capEnd_ = nullptr;
+        begin_ = end_ = inline_.data();
+        capEnd_ = begin_ + InlineCapacity;
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    void LinearContainer<T, IMemoryBackend>::push_back(const T& value) {
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    void LinearContainer<T, IMemoryBackend, InlineCapacity>::push_back(const T& value) {
 
         T* pos = end_;
 
@@ -287,8 +299,8 @@ namespace gema{
         push_back_slow(value);
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    void LinearContainer<T, IMemoryBackend>::pop_back() {
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    void LinearContainer<T, IMemoryBackend, InlineCapacity>::pop_back() {
 
         --end_;
         if constexpr(!std::is_trivially_destructible_v<T>){
@@ -297,16 +309,26 @@ namespace gema{
         }
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    void LinearContainer<T, IMemoryBackend>::swap(LinearContainer<T, IMemoryBackend>& other) noexcept {
-        std::swap(begin_, other.begin_);
-        std::swap(end_, other.end_);
-        std::swap(capEnd_, other.capEnd_);
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    void LinearContainer<T, IMemoryBackend, InlineCapacity>::swap(LinearContainer<T, IMemoryBackend, InlineCapacity>& other) noexcept {
+
+        if(!isInline() && !other.isInline()){
+            std::swap(begin_, other.begin_);
+            std::swap(end_, other.end_);
+            std::swap(capEnd_, other.capEnd_);
+            return;
+        }
+
+        // Inline items stay in their object, so they are moved instead of pointers
+        LinearContainer<T, IMemoryBackend, InlineCapacity> temporary(other.memoryBackend_);
+        temporary.takeItems(other);
+        other.takeItems(*this);
+        takeItems(temporary);
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    typename LinearContainer<T, IMemoryBackend>::iterator 
-    LinearContainer<T, IMemoryBackend>::insert(iterator pos, const T& value){
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    typename LinearContainer<T, IMemoryBackend, InlineCapacity>::iterator 
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::insert(iterator pos, const T& value){
 
         size_t index = pos - begin_;
         size_t oldSize = size();
@@ -328,7 +350,9 @@ namespace gema{
 
             // cleanup
             memoryBackend_.destroy(begin_, end_);
-            memoryBackend_.deallocate(begin_, capacity());
+            if(!isInline()){
+                memoryBackend_.deallocate(begin_, capacity());
+            }
 
             begin_ = newData;
             end_   = newData + oldSize + 1;
@@ -349,8 +373,8 @@ namespace gema{
         return begin_ + index;
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    typename LinearContainer<T, IMemoryBackend>::iterator LinearContainer<T, IMemoryBackend>::erase(iterator pos){
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    typename LinearContainer<T, IMemoryBackend, InlineCapacity>::iterator LinearContainer<T, IMemoryBackend, InlineCapacity>::erase(iterator pos){
 
         size_t index = pos - begin_;
 
@@ -370,13 +394,13 @@ namespace gema{
         return begin_ + index;
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    void LinearContainer<T, IMemoryBackend>::fill(const T& value){
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    void LinearContainer<T, IMemoryBackend, InlineCapacity>::fill(const T& value){
         fastFill(begin_, size(), value);
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    void LinearContainer<T, IMemoryBackend>::assign(size_t count, const T& value){
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    void LinearContainer<T, IMemoryBackend, InlineCapacity>::assign(size_t count, const T& value){
 
         if(count > capacity()){
             reserve(count);
@@ -399,9 +423,9 @@ namespace gema{
         end_ = begin_ + count;
     }
 
-    template <class T, MemoryBackendConcept<T> IMemoryBackend>
+    template <class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
     template <class I>
-    void LinearContainer<T, IMemoryBackend>::assign(I first, I last)
+    void LinearContainer<T, IMemoryBackend, InlineCapacity>::assign(I first, I last)
     {
 
         size_t count = static_cast<size_t>(std::distance(first, last));
@@ -419,17 +443,22 @@ namespace gema{
         end_ = begin_ + count;
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    void LinearContainer<T, IMemoryBackend>::assign(std::initializer_list<T> ilist){
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    void LinearContainer<T, IMemoryBackend, InlineCapacity>::assign(std::initializer_list<T> ilist){
         assign(ilist.begin(), ilist.end());
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    bool LinearContainer<T, IMemoryBackend>::operator==(const LinearContainer<T, IMemoryBackend>& other) const {
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    bool LinearContainer<T, IMemoryBackend, InlineCapacity>::operator==(const LinearContainer<T, IMemoryBackend, InlineCapacity>& other) const {
 
         size_t n = size();
         if(n != other.size()) return false;
 
+        // Inline items are in host memory, which backend kernels might not be able to read
+        if(isInline() || other.isInline()){
+            return MemoryBackend<T>().equals(begin_, other.begin_, n);
+        }
+
         return memoryBackend_.equals(begin_, other.begin_, n);
 
         // if constexpr(std::is_trivially_copyable_v<T> /*&& std::has_unique_object_representations_v<T>*/){
@@ -444,12 +473,16 @@ namespace gema{
         return true;
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    std::partial_ordering LinearContainer<T, IMemoryBackend>::operator<=>(const LinearContainer<T, IMemoryBackend>& other) const {
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    std::partial_ordering LinearContainer<T, IMemoryBackend, InlineCapacity>::operator<=>(const LinearContainer<T, IMemoryBackend, InlineCapacity>& other) const {
 
         size_t otherSize = other.size();
         if(size() != otherSize) return std::partial_ordering::unordered;
 
+        if(isInline() || other.isInline()){
+            return MemoryBackend<T>().compare(begin_, other.begin_, otherSize);
+        }
+
         return memoryBackend_.compare(begin_, other.begin_, otherSize);
 
         // for(size_t i = 0; i < n; ++i){
@@ -461,99 +494,150 @@ namespace gema{
         // return size() <=> other.size();
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    T& LinearContainer<T, IMemoryBackend>::operator[](size_t i) { 
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    template <size_t OtherCapacity>
+    bool LinearContainer<T, IMemoryBackend, InlineCapacity>::operator==
+    (const LinearContainer<T, IMemoryBackend, OtherCapacity>& other) const requires (OtherCapacity != InlineCapacity){
+
+        size_t n = size();
+        if(n != other.size()) return false;
+
+        if(isInline() || other.isInline()){
+            return MemoryBackend<T>().equals(begin_, other.begin_, n);
+        }
+
+        return memoryBackend_.equals(begin_, other.begin_, n);
+    }
+
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    T& LinearContainer<T, IMemoryBackend, InlineCapacity>::operator[](size_t i) { 
         return *(begin_ + i);
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    const T& LinearContainer<T, IMemoryBackend>::operator[](size_t i) const { 
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    const T& LinearContainer<T, IMemoryBackend, InlineCapacity>::operator[](size_t i) const { 
         return *(begin_ + i);
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    T* LinearContainer<T, IMemoryBackend>::data(){
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    T* LinearContainer<T, IMemoryBackend, InlineCapacity>::data(){
         return begin_;
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    const T* LinearContainer<T, IMemoryBackend>::data() const {
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    const T* LinearContainer<T, IMemoryBackend, InlineCapacity>::data() const {
         return begin_;
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    T& LinearContainer<T, IMemoryBackend>::front(){
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    T& LinearContainer<T, IMemoryBackend, InlineCapacity>::front(){
         return *begin_;
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    const T& LinearContainer<T, IMemoryBackend>::front() const{
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    const T& LinearContainer<T, IMemoryBackend, InlineCapacity>::front() const{
         return *begin_;
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    T& LinearContainer<T, IMemoryBackend>::back(){
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    T& LinearContainer<T, IMemoryBackend, InlineCapacity>::back(){
         return *(end_-1);
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    const T& LinearContainer<T, IMemoryBackend>::back() const{
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    const T& LinearContainer<T, IMemoryBackend, InlineCapacity>::back() const{
         return *(end_-1);
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    size_t LinearContainer<T, IMemoryBackend>::size() const{
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    size_t LinearContainer<T, IMemoryBackend, InlineCapacity>::size() const{
         return static_cast<size_t>(end_ - begin_);
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    size_t LinearContainer<T, IMemoryBackend>::capacity() const{
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    size_t LinearContainer<T, IMemoryBackend, InlineCapacity>::capacity() const{
         return static_cast<size_t>(capEnd_ - begin_);
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>::iterator LinearContainer<T, IMemoryBackend>::begin(){
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::iterator LinearContainer<T, IMemoryBackend, InlineCapacity>::begin(){
         return begin_;
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>::iterator LinearContainer<T, IMemoryBackend>::end(){
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::iterator LinearContainer<T, IMemoryBackend, InlineCapacity>::end(){
         return end_;
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>::const_iterator LinearContainer<T, IMemoryBackend>::begin() const{
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::const_iterator LinearContainer<T, IMemoryBackend, InlineCapacity>::begin() const{
         return begin_;
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>::const_iterator LinearContainer<T, IMemoryBackend>::end() const{
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::const_iterator LinearContainer<T, IMemoryBackend, InlineCapacity>::end() const{
         return end_;
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>::reverse_iterator LinearContainer<T, IMemoryBackend>::rbegin(){
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::reverse_iterator LinearContainer<T, IMemoryBackend, InlineCapacity>::rbegin(){
         return reverse_iterator(end());
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>::reverse_iterator LinearContainer<T, IMemoryBackend>::rend(){
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::reverse_iterator LinearContainer<T, IMemoryBackend, InlineCapacity>::rend(){
         return reverse_iterator(begin());
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>::const_reverse_iterator LinearContainer<T, IMemoryBackend>::rbegin() const{
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::const_reverse_iterator LinearContainer<T, IMemoryBackend, InlineCapacity>::rbegin() const{
         return const_reverse_iterator(end());
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    LinearContainer<T, IMemoryBackend>::const_reverse_iterator LinearContainer<T, IMemoryBackend>::rend() const{
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    LinearContainer<T, IMemoryBackend, InlineCapacity>::const_reverse_iterator LinearContainer<T, IMemoryBackend, InlineCapacity>::rend() const{
         return const_reverse_iterator(begin());
     }
 
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    void LinearContainer<T, IMemoryBackend>::push_back_slow(const T& value){
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    bool LinearContainer<T, IMemoryBackend, InlineCapacity>::isInline() const{
+
+        if constexpr(InlineCapacity == 0){
+            return false;
+        }else{
+            return begin_ == inline_.data();
+        }
+    }
+
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    void LinearContainer<T, IMemoryBackend, InlineCapacity>::takeItems(LinearContainer<T, IMemoryBackend, InlineCapacity>& other) noexcept{
+
+        if constexpr(InlineCapacity > 0){
+            if(other.isInline()){
+
+                const size_t otherSize = other.size();
+                std::memcpy(inline_.data(), other.inline_.data(), otherSize * sizeof(T));
+
+                begin_  = inline_.data();
+                end_    = begin_ + otherSize;
+                capEnd_ = begin_ + InlineCapacity;
+
+                other.end_ = other.begin_;
+                return;
+            }
+        }
+
+        begin_  = other.begin_;
+        end_    = other.end_;
+        capEnd_ = other.capEnd_;
+
+        other.begin_ = other.end_ = other.inline_.data();
+        other.capEnd_ = other.begin_ + InlineCapacity;
+    }
+
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    void LinearContainer<T, IMemoryBackend, InlineCapacity>::push_back_slow(const T& value){
 
         size_t oldSize = size();
         size_t newCap  = capacity() ? (capacity() + (capacity() / 2) + 8) : 8;
@@ -566,8 +650,8 @@ namespace gema{
 
     }
 
-    template<class T, MemoryBackendConcept<T> IMemoryBackend>
-    void LinearContainer<T, IMemoryBackend>::fastFill(T* dest, size_t count, const T& value){
+    template<class T, MemoryBackendConcept<T> IMemoryBackend, size_t InlineCapacity>
+    void LinearContainer<T, IMemoryBackend, InlineCapacity>::fastFill(T* dest, size_t count, const T& value){
 
         if constexpr(std::is_trivially_copyable_v<T>){
 
@@ -1,13 +1,34 @@
 #ifndef MATRIX_HPP
 #define MATRIX_HPP
 
+#include <cstdint>
+#include <string>
+
 #include "TensorConcept.hpp"
 #include "Tensor.hpp"
 
 namespace gema{
 
+// ============================================================================================================================
+/**
+ * @brief Two dimensional tensor with linear algebra operations. Items are stored in rows, so coordinates are {row, column}
+ * and item on them is on index row * columns + column of the data.
+ *
+ * @par
+ * Matrix multiplication
+ * @par
+ * Product is computed by cache blocked algorithm. Block of columns of the right operand and block of the left operand are
+ * first copied (packed) into buffers, where items that the innermost loop reads one after another are contiguous, so the
+ * blocks stay in L2 and L1 cache while they are used. Innermost micro-kernel keeps MR x NR tile of the result in local
+ * accumulators, that compiler places into vector registers, NR is one cache line of items for float and double so one row
+ * of the tile is one or two AVX-512/AVX2 registers. Other types use the same algorithm with small scalar tile. Blocks of
+ * rows of the result are split between threads.
+ *
+ * @tparam T type of items.
+ * @tparam ITensor tensor class used as storage.
+ */
 template<class T, template <typename> class ITensor = Tensor>
-requires TensorConcept<ITensor, T>
+requires TensorConcept<ITensor<T>, T>
 class Matrix{
 
     private:
@@ -16,47 +37,73 @@ class Matrix{
 
     public:
 
+    using value_type = T;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Makes matrix of given size, items are default initialized.
+     *
+     * @param x number of rows.
+     * @param y number of columns.
+     */
     Matrix(const int64_t x, const int64_t y);
 
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Makes matrix of given size and fills it with data by rows.
+     *
+     * @param x number of rows.
+     * @param y number of columns.
+     * @param newMatrixData items by rows.
+     */
     Matrix(const int64_t x, const int64_t y, const LinearContainer<T>& newMatrixData);
 
-    Matrix(const Matrix<T>& otherMatrix);
+    Matrix(const Matrix<T, ITensor>& otherMatrix);
 
-    Matrix(Matrix<T>&& otherMatrix);
+    Matrix(Matrix<T, ITensor>&& otherMatrix);
 
     Matrix();
 
 
 
-    const std::vector<uint64_t>& getDimensionSizes() const;
+    const auto& getDimensionSizes() const;
+
+    uint64_t getNumberOfRows() const;
+
+    uint64_t getNumberOfColumns() const;
 
     uint64_t getNumberOfDimensions() const;
 
     uint64_t getNumberOfItems() const;
 
-    T& getItem(const std::vector<uint64_t>& coordinates);
+    T& getItem(span_view<uint64_t> coordinates);
+
+    void setItem(const T& value, span_view<uint64_t> coordinates);
 
-    void setItem(const T& value, const std::vector<uint64_t>& coordinates);
+    T* getData();
 
-    LinearContainer<T>& getData();
+    const T* getData() const;
 
-    Tensor<T>& setData(const LinearContainer<T>& tensorItems);
+    Matrix<T, ITensor>& setData(const LinearContainer<T>& matrixItems);
 
     std::string toString() const;
 
-    template<typename U> friend std::ostream& operator<<(std::ostream& os, const Tensor<U>& tensor);
+    template<typename U, template <typename> class IT> 
+    friend std::ostream& operator<<(std::ostream& os, const Matrix<U, IT>& matrix);
 
     void fillWith(const T& fill);
 
-    Tensor<T> transposition(const int dim1 = 0, const int dim2 = 1) const;
+    Matrix<T, ITensor> transpositionAndReturn() const;
+
+    void transposition();
 
     void resize(const uint64_t dim1, const uint64_t dim2);
 
-    Tensor<T>& operator=(const Tensor<T>& tensor2);
+    Matrix<T, ITensor>& operator=(const Matrix<T, ITensor>& otherMatrix);
 
-    bool operator==(const Tensor<T>& tensor2) const;
+    Matrix<T, ITensor>& operator=(Matrix<T, ITensor>&& otherMatrix);
 
-    bool operator!=(const Tensor<T>& tensor2) const;
+    bool operator==(const Matrix<T, ITensor>& otherMatrix) const;
+
+    bool operator!=(const Matrix<T, ITensor>& otherMatrix) const;
 
 
     #define ARITHMETIC_BINARY_ToTrT(OP_SYMBOL)\
@@ -123,11 +170,47 @@ class Matrix{
 
     #undef ARITHMETIC_BINARY
 
-    Matrix<T>& inverse() const;
-
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Calculates inverse matrix by Gauss-Jordan elimination with partial pivoting.
+     *
+     * @return Inverse of this matrix.
+     *
+     * @warning Matrix must be square and regular, inverse of singular matrix contains infinities or NaN.
+     */
+    Matrix<T, ITensor> inverse() const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Replaces this matrix by its inverse, see Matrix<T>::inverse.
+     */
     void inverseInPlace();
 
-    void matrixMultiplication(const Matrix& otherMatrix);
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Multiplies this matrix from the right by other matrix, this = this * otherMatrix.
+     *
+     * @param otherMatrix right operand, number of its rows must be the number of columns of this matrix.
+     */
+    void matrixMultiplication(const Matrix<T, ITensor>& otherMatrix);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Calculates product of this matrix and other matrix.
+     *
+     * @param otherMatrix right operand, number of its rows must be the number of columns of this matrix.
+     *
+     * @return New matrix this * otherMatrix.
+     */
+    Matrix<T, ITensor> matrixMultiplicationAndReturn(const Matrix<T, ITensor>& otherMatrix) const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Calculates c = a * b on raw data stored by rows, the engine behind matrix multiplication.
+     *
+     * @param a left operand of size m x k.
+     * @param b right operand of size k x n.
+     * @param c result of size m x n, must not overlap the operands, its previous content is overwritten.
+     * @param m number of rows of a and c.
+     * @param n number of columns of b and c.
+     * @param k number of columns of a and rows of b.
+     */
+    static void multiply(const T* a, const T* b, T* c, const uint64_t m, const uint64_t n, const uint64_t k);
     
     virtual ~Matrix();
 
@@ -135,14 +218,34 @@ class Matrix{
 
     private:
 
-    std::vector<uint64_t> getCoords(uint64_t itemIndex) const;
+    /// Rows of the micro-kernel tile.
+    constexpr static uint64_t microRows_ = std::is_floating_point_v<T> ? 6 : 4;
+    /// Columns of the micro-kernel tile, one cache line of floats or doubles.
+    constexpr static uint64_t microColumns_ = std::is_floating_point_v<T> ? 64 / sizeof(T) : 4;
+    /// Rows of the packed block of the left operand, the block should fit into L2 cache.
+    constexpr static uint64_t blockRows_ = 16 * microRows_;
+    /// Shared dimension of packed blocks, one micro-panel of the right operand should fit into L1 cache.
+    constexpr static uint64_t blockDepth_ = 256;
+    /// Columns of the packed block of the right operand, the block should fit into L3 cache.
+    constexpr static uint64_t blockColumns_ = 128 * microColumns_;
+
+    // Copies rows x depth block of a into micro-panels of microRows_ rows, stored column by column, padded with zeros
+    static void packLeft(const T* a, const uint64_t lda, const uint64_t rows, const uint64_t depth, T* packed);
 
-    uint64_t getIndex(const std::vector<uint64_t>& coordinates) const;
+    // Copies depth x columns block of b into micro-panels of microColumns_ columns, stored row by row, padded with zeros
+    static void packRight(const T* b, const uint64_t ldb, const uint64_t depth, const uint64_t columns, T* packed);
+
+    // Adds product of one packed micro-panel pair to rows x columns tile of c
+    static void microKernel(const T* packedA, const T* packedB, const uint64_t depth, T* c, const uint64_t ldc, 
+    const uint64_t rows, const uint64_t columns);
 
 };
 
+template<typename U, template <typename> class IT> 
+std::ostream& operator<<(std::ostream& os, const Matrix<U, IT>& matrix);
+
 }
 
 #include "Matrix.tpp"
 
-#endif
\ No newline at end of file
+#endif
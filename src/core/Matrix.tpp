@@ -1,5 +1,399 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include "Matrix.hpp"
 
 namespace gema {
 
+    template<class T, template <typename> class ITensor>
+    Matrix<T, ITensor>::Matrix(const int64_t x, const int64_t y)
+    : tensor_(LinearContainer<uint64_t>{static_cast<uint64_t>(x), static_cast<uint64_t>(y)}){
+
+    }
+
+    template<class T, template <typename> class ITensor>
+    Matrix<T, ITensor>::Matrix(const int64_t x, const int64_t y, const LinearContainer<T>& newMatrixData)
+    : tensor_(LinearContainer<uint64_t>{static_cast<uint64_t>(x), static_cast<uint64_t>(y)}, newMatrixData){
+
+    }
+
+    template<class T, template <typename> class ITensor>
+    Matrix<T, ITensor>::Matrix(const Matrix<T, ITensor>& otherMatrix)
+    : tensor_(otherMatrix.tensor_){
+
+    }
+
+    template<class T, template <typename> class ITensor>
+    Matrix<T, ITensor>::Matrix(Matrix<T, ITensor>&& otherMatrix)
+    : tensor_(std::move(otherMatrix.tensor_)){
+
+    }
+
+    template<class T, template <typename> class ITensor>
+    Matrix<T, ITensor>::Matrix()
+    : tensor_(){
+
+    }
+
+    template<class T, template <typename> class ITensor>
+    const auto& Matrix<T, ITensor>::getDimensionSizes() const {
+        return tensor_.getDimensionSizes();
+    }
+
+    template<class T, template <typename> class ITensor>
+    uint64_t Matrix<T, ITensor>::getNumberOfRows() const {
+        return tensor_.getDimensionSizes()[0];
+    }
+
+    template<class T, template <typename> class ITensor>
+    uint64_t Matrix<T, ITensor>::getNumberOfColumns() const {
+        return tensor_.getDimensionSizes()[1];
+    }
+
+    template<class T, template <typename> class ITensor>
+    uint64_t Matrix<T, ITensor>::getNumberOfDimensions() const {
+        return tensor_.getNumberOfDimensions();
+    }
+
+    template<class T, template <typename> class ITensor>
+    uint64_t Matrix<T, ITensor>::getNumberOfItems() const {
+        return tensor_.getNumberOfItems();
+    }
+
+    template<class T, template <typename> class ITensor>
+    T& Matrix<T, ITensor>::getItem(span_view<uint64_t> coordinates){
+        return tensor_.getItem(coordinates);
+    }
+
+    template<class T, template <typename> class ITensor>
+    void Matrix<T, ITensor>::setItem(const T& value, span_view<uint64_t> coordinates){
+        tensor_.setItem(value, coordinates);
+    }
+
+    template<class T, template <typename> class ITensor>
+    T* Matrix<T, ITensor>::getData(){
+        return tensor_.getData();
+    }
+
+    template<class T, template <typename> class ITensor>
+    const T* Matrix<T, ITensor>::getData() const {
+        return tensor_.getData();
+    }
+
+    template<class T, template <typename> class ITensor>
+    Matrix<T, ITensor>& Matrix<T, ITensor>::setData(const LinearContainer<T>& matrixItems){
+        tensor_.setData(matrixItems);
+        return *this;
+    }
+
+    template<class T, template <typename> class ITensor>
+    std::string Matrix<T, ITensor>::toString() const {
+        return tensor_.toString();
+    }
+
+    template<typename U, template <typename> class IT>
+    std::ostream& operator<<(std::ostream& os, const Matrix<U, IT>& matrix){
+        return os << matrix.toString();
+    }
+
+    template<class T, template <typename> class ITensor>
+    void Matrix<T, ITensor>::fillWith(const T& fill){
+        tensor_.fillWith(fill);
+    }
+
+    template<class T, template <typename> class ITensor>
+    Matrix<T, ITensor> Matrix<T, ITensor>::transpositionAndReturn() const {
+
+        Matrix<T, ITensor> transposed(*this);
+        transposed.transposition();
+        return transposed;
+    }
+
+    template<class T, template <typename> class ITensor>
+    void Matrix<T, ITensor>::transposition(){
+        tensor_.transposition(0, 1);
+    }
+
+    template<class T, template <typename> class ITensor>
+    void Matrix<T, ITensor>::resize(const uint64_t dim1, const uint64_t dim2){
+        tensor_.resize(LinearContainer<uint64_t>{dim1, dim2});
+    }
+
+    template<class T, template <typename> class ITensor>
+    Matrix<T, ITensor>& Matrix<T, ITensor>::operator=(const Matrix<T, ITensor>& otherMatrix){
+        tensor_ = otherMatrix.tensor_;
+        return *this;
+    }
+
+    template<class T, template <typename> class ITensor>
+    Matrix<T, ITensor>& Matrix<T, ITensor>::operator=(Matrix<T, ITensor>&& otherMatrix){
+        tensor_ = std::move(otherMatrix.tensor_);
+        return *this;
+    }
+
+    template<class T, template <typename> class ITensor>
+    bool Matrix<T, ITensor>::operator==(const Matrix<T, ITensor>& otherMatrix) const {
+        return tensor_ == otherMatrix.tensor_;
+    }
+
+    template<class T, template <typename> class ITensor>
+    bool Matrix<T, ITensor>::operator!=(const Matrix<T, ITensor>& otherMatrix) const {
+        return tensor_ != otherMatrix.tensor_;
+    }
+
+    template<class T, template <typename> class ITensor>
+    Matrix<T, ITensor> Matrix<T, ITensor>::inverse() const {
+
+        Matrix<T, ITensor> inverted(*this);
+        inverted.inverseInPlace();
+        return inverted;
+    }
+
+    template<class T, template <typename> class ITensor>
+    void Matrix<T, ITensor>::inverseInPlace(){
+
+        using std::abs;
+
+        const uint64_t n = getNumberOfRows();
+
+        // Eliminated copy of this matrix, while identity in the data of this matrix turns into the inverse
+        std::vector<T> work(getData(), getData() + n * n);
+        T* inverted = getData();
+
+        std::fill(inverted, inverted + n * n, T{});
+        for(uint64_t i = 0; i < n; ++i){
+            inverted[i * n + i] = T{1};
+        }
+
+        for(uint64_t column = 0; column < n; ++column){
+
+            uint64_t pivotRow = column;
+            for(uint64_t row = column + 1; row < n; ++row){
+                if(abs(work[row * n + column]) > abs(work[pivotRow * n + column])){
+                    pivotRow = row;
+                }
+            }
+
+            if(pivotRow != column){
+                std::swap_ranges(work.begin() + pivotRow * n, work.begin() + (pivotRow + 1) * n, work.begin() + column * n);
+                std::swap_ranges(inverted + pivotRow * n, inverted + (pivotRow + 1) * n, inverted + column * n);
+            }
+
+            T* pivotWorkRow = work.data() + column * n;
+            T* pivotInvertedRow = inverted + column * n;
+
+            const T pivotInverse = T{1} / pivotWorkRow[column];
+            for(uint64_t j = 0; j < n; ++j){
+                pivotWorkRow[j] *= pivotInverse;
+                pivotInvertedRow[j] *= pivotInverse;
+            }
+
+            for(uint64_t row = 0; row < n; ++row){
+
+                const T factor = work[row * n + column];
+                if(row == column || factor == T{}) continue;
+
+                T* workRow = work.data() + row * n;
+                T* invertedRow = inverted + row * n;
+
+                for(uint64_t j = 0; j < n; ++j){
+                    workRow[j] -= factor * pivotWorkRow[j];
+                    invertedRow[j] -= factor * pivotInvertedRow[j];
+                }
+            }
+        }
+    }
+
+    template<class T, template <typename> class ITensor>
+    void Matrix<T, ITensor>::matrixMultiplication(const Matrix<T, ITensor>& otherMatrix){
+        *this = matrixMultiplicationAndReturn(otherMatrix);
+    }
+
+    template<class T, template <typename> class ITensor>
+    Matrix<T, ITensor> Matrix<T, ITensor>::matrixMultiplicationAndReturn(const Matrix<T, ITensor>& otherMatrix) const {
+
+        const uint64_t m = getNumberOfRows();
+        const uint64_t k = getNumberOfColumns();
+        const uint64_t n = otherMatrix.getNumberOfColumns();
+
+        Matrix<T, ITensor> product(m, n);
+        multiply(getData(), otherMatrix.getData(), product.getData(), m, n, k);
+
+        return product;
+    }
+
+    template<class T, template <typename> class ITensor>
+    /*static*/ void Matrix<T, ITensor>::multiply(
+        const T* a,
+        const T* b,
+        T* c,
+        const uint64_t m,
+        const uint64_t n,
+        const uint64_t k
+    ){
+
+        std::fill(c, c + m * n, T{});
+
+        if(m == 0 || n == 0 || k == 0) return;
+
+        const uint64_t rowBlockCount = (m + blockRows_ - 1) / blockRows_;
+
+        // Threads are worth it only when every one of them gets enough multiply-adds
+        constexpr uint64_t minOperationsPerThread = 1 << 22;
+        const uint64_t threadCount = std::max<uint64_t>(1, std::min<uint64_t>({
+            std::max(1u, std::thread::hardware_concurrency()),
+            m * n * k / minOperationsPerThread,
+            rowBlockCount
+        }));
+
+        const uint64_t packedColumns = (std::min(blockColumns_, n) + microColumns_ - 1) / microColumns_ * microColumns_;
+        const uint64_t packedDepth = std::min(blockDepth_, k);
+
+        std::vector<T> packedB(packedColumns * packedDepth);
+        std::vector<std::vector<T>> packedA(threadCount, std::vector<T>(blockRows_ * packedDepth));
+
+        for(uint64_t jc = 0; jc < n; jc += blockColumns_){
+
+            const uint64_t nc = std::min(blockColumns_, n - jc);
+
+            for(uint64_t pc = 0; pc < k; pc += blockDepth_){
+
+                const uint64_t kc = std::min(blockDepth_, k - pc);
+
+                packRight(b + pc * n + jc, n, kc, nc, packedB.data());
+
+                const auto multiplyRowBlocks = [=, &packedB](const uint64_t firstBlock, const uint64_t lastBlock, T* packedLeft){
+
+                    for(uint64_t block = firstBlock; block < lastBlock; ++block){
+
+                        const uint64_t ic = block * blockRows_;
+                        const uint64_t mc = std::min(blockRows_, m - ic);
+
+                        packLeft(a + ic * k + pc, k, mc, kc, packedLeft);
+
+                        for(uint64_t jr = 0; jr < nc; jr += microColumns_){
+                            for(uint64_t ir = 0; ir < mc; ir += microRows_){
+                                microKernel(packedLeft + ir * kc, packedB.data() + jr * kc, kc, c + (ic + ir) * n + jc + jr, n,
+                                    std::min(microRows_, mc - ir), std::min(microColumns_, nc - jr));
+                            }
+                        }
+                    }
+                };
+
+                if(threadCount <= 1){
+                    multiplyRowBlocks(0, rowBlockCount, packedA[0].data());
+                    continue;
+                }
+
+                std::vector<std::jthread> threads;
+                threads.reserve(threadCount);
+
+                const uint64_t chunkSize = rowBlockCount / threadCount;
+                for(uint64_t t = 0; t < threadCount; ++t){
+
+                    const uint64_t begin = t * chunkSize;
+                    const uint64_t end = (t == threadCount - 1) ? rowBlockCount : begin + chunkSize;
+
+                    threads.emplace_back(multiplyRowBlocks, begin, end, packedA[t].data());
+                }
+            } // Threads join before the packed block of b is overwritten
+        }
+    }
+
+    template<class T, template <typename> class ITensor>
+    Matrix<T, ITensor>::~Matrix(){
+
+    }
+
+    // PRIVATE METHODS: -------------------------------------------------------------------------------------------------------
+
+    template<class T, template <typename> class ITensor>
+    /*static*/ void Matrix<T, ITensor>::packLeft(
+        const T* a,
+        const uint64_t lda,
+        const uint64_t rows,
+        const uint64_t depth,
+        T* packed
+    ){
+
+        for(uint64_t panelRow = 0; panelRow < rows; panelRow += microRows_){
+
+            const uint64_t panelRows = std::min(microRows_, rows - panelRow);
+            T* panel = packed + panelRow * depth;
+
+            for(uint64_t p = 0; p < depth; ++p){
+                for(uint64_t i = 0; i < microRows_; ++i){
+                    panel[p * microRows_ + i] = (i < panelRows) ? a[(panelRow + i) * lda + p] : T{};
+                }
+            }
+        }
+    }
+
+    template<class T, template <typename> class ITensor>
+    /*static*/ void Matrix<T, ITensor>::packRight(
+        const T* b,
+        const uint64_t ldb,
+        const uint64_t depth,
+        const uint64_t columns,
+        T* packed
+    ){
+
+        for(uint64_t panelColumn = 0; panelColumn < columns; panelColumn += microColumns_){
+
+            const uint64_t panelColumns = std::min(microColumns_, columns - panelColumn);
+            T* panel = packed + panelColumn * depth;
+
+            for(uint64_t p = 0; p < depth; ++p){
+
+                const T* row = b + p * ldb + panelColumn;
+
+                for(uint64_t j = 0; j < microColumns_; ++j){
+                    panel[p * microColumns_ + j] = (j < panelColumns) ? row[j] : T{};
+                }
+            }
+        }
+    }
+
+    template<class T, template <typename> class ITensor>
+    /*static*/ void Matrix<T, ITensor>::microKernel(
+        const T* packedA,
+        const T* packedB,
+        const uint64_t depth,
+        T* c,
+        const uint64_t ldc,
+        const uint64_t rows,
+        const uint64_t columns
+    ){
+
+        // Fixed size tile, loops over it are unrolled and the inner one vectorized
+        std::array<T, microRows_ * microColumns_> accumulators{};
+
+        for(uint64_t p = 0; p < depth; ++p){
+
+            const T* aColumn = packedA + p * microRows_;
+            const T* bRow = packedB + p * microColumns_;
+
+            // Without explicit unrolling GCC vectorizes across rows and shuffles the tile on every step
+            #pragma GCC unroll 16
+            for(uint64_t i = 0; i < microRows_; ++i){
+
+                const T aItem = aColumn[i];
+
+                for(uint64_t j = 0; j < microColumns_; ++j){
+                    accumulators[i * microColumns_ + j] += aItem * bRow[j];
+                }
+            }
+        }
+
+        for(uint64_t i = 0; i < rows; ++i){
+            for(uint64_t j = 0; j < columns; ++j){
+                c[i * ldc + j] += accumulators[i * microColumns_ + j];
+            }
+        }
+    }
 }
@@ -1,21 +1,201 @@
 #ifndef MATRIX_PARALLEL_HPP
 #define MATRIX_PARALLEL_HPP
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <sycl/sycl.hpp>
+
 #include "Tensor.hpp"
 #include "TensorParallel.hpp"
 #include "Matrix.hpp"
 
 namespace gema{
 
-template<class T, TensorType<T> ITensor = TensorParallel<T>>
-class MatrixParallel : Matrix<T>{
+// ============================================================================================================================
+/**
+ * @brief Two dimensional TensorParallel with linear algebra operations computed on the device of its queue. Items are stored
+ * in rows, the same way as in Matrix<T>.
+ *
+ * @par
+ * Matrix multiplication
+ * @par
+ * Product is computed by nd_range kernel, where every work-group computes one square tile of the result and every work-item
+ * one item of it. The common dimension is walked by tiles too, both operand tiles are first loaded into local memory by
+ * the whole work-group, so every item is read from global memory once per work-group instead of once per work-item. Tile
+ * side is chosen at runtime from maximal work-group size and local memory size of the device. Transposed operands are
+ * loaded with swapped local ids, so neighbouring work-items still read neighbouring items.
+ *
+ * @par
+ * Like TensorParallel, operations do not wait for the kernel, host waits only when it needs the data.
+ *
+ * @tparam T type of items.
+ */
+template<class T>
+class MatrixParallel{
 
     private:
 
+    TensorParallel<T> tensor_;
+
+    /// Upper bound of the tile side, 16 x 16 work-items fit maximal work-group size of any usual device.
+    constexpr static uint64_t maxTileSide_ = 16;
+
+    public:
+
+    using value_type = T;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Makes matrix of given size, items are not initialized.
+     *
+     * @param x number of rows.
+     * @param y number of columns.
+     */
+    MatrixParallel(const uint64_t x, const uint64_t y);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Makes matrix of given size and fills it with data by rows.
+     *
+     * @param x number of rows.
+     * @param y number of columns.
+     * @param newMatrixData items by rows.
+     */
+    MatrixParallel(const uint64_t x, const uint64_t y, const LinearContainer<T>& newMatrixData);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Makes matrix from two dimensional tensor.
+     *
+     * @param tensor tensor with two dimensions {rows, columns}.
+     */
+    explicit MatrixParallel(const TensorParallel<T>& tensor);
+
+    explicit MatrixParallel(TensorParallel<T>&& tensor);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Copies host matrix to the device.
+     *
+     * @param matrix matrix to copy.
+     */
+    explicit MatrixParallel(const Matrix<T>& matrix);
+
+    MatrixParallel(const MatrixParallel<T>& otherMatrix) = default;
+
+    MatrixParallel(MatrixParallel<T>&& otherMatrix) noexcept = default;
+
+    MatrixParallel();
+
+    MatrixParallel<T>& operator=(const MatrixParallel<T>& otherMatrix) = default;
+
+    MatrixParallel<T>& operator=(MatrixParallel<T>&& otherMatrix) noexcept = default;
+
+
+
+    const TensorParallel<T>& getTensor() const;
+    TensorParallel<T>& getTensor();
+
+    uint64_t getNumberOfRows() const;
+
+    uint64_t getNumberOfColumns() const;
+
+    uint64_t getNumberOfItems() const;
+
+    T getItem(span_view<uint64_t> coordinates);
+
+    void setItem(const T& value, span_view<uint64_t> coordinates);
+
+    // Waits until all submitted kernels working with this matrix are finished
+    void sync() const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Copies the matrix from the device to host matrix.
+     *
+     * @return Host matrix with the same items.
+     */
+    Matrix<T> toMatrix() const;
+
+    std::string toString() const;
+
+    template <class U>
+    friend std::ostream& operator<<(std::ostream& os, const MatrixParallel<U>& matrix);
+
+    bool operator==(const MatrixParallel<T>& otherMatrix) const;
+
+    bool operator!=(const MatrixParallel<T>& otherMatrix) const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Multiplies this matrix from the right by other matrix, this = this * otherMatrix.
+     *
+     * @param otherMatrix right operand, number of its rows must be the number of columns of this matrix.
+     */
+    void matrixMultiplication(const MatrixParallel<T>& otherMatrix);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Calculates product of this matrix and other matrix.
+     *
+     * @param otherMatrix right operand, number of its rows must be the number of columns of this matrix.
+     *
+     * @return New matrix this * otherMatrix.
+     */
+    MatrixParallel<T> matrixMultiplicationAndReturn(const MatrixParallel<T>& otherMatrix) const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Calculates product of optionally transposed operands, without transposing any data.
+     *
+     * @param otherMatrix right operand.
+     * @param transposeThis if @b true, this matrix is used transposed.
+     * @param transposeOther if @b true, other matrix is used transposed.
+     *
+     * @return New matrix op(this) * op(otherMatrix).
+     */
+    MatrixParallel<T> transposedMultiplicationAndReturn(const MatrixParallel<T>& otherMatrix, const bool transposeThis,
+    const bool transposeOther) const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Multiplies batches of matrices in one kernel. Operand with three dimensions {batch, rows, columns} is a batch of
+     * matrices, operand with two dimensions is one matrix used with every matrix of the other operand.
+     *
+     * @param tensor1 left operands, {batch, m, k} or {m, k}.
+     * @param tensor2 right operands, {batch, k, n} or {k, n}.
+     * @param transpose1 if @b true, every left operand is used transposed, so it is {batch, k, m} or {k, m}.
+     * @param transpose2 if @b true, every right operand is used transposed, so it is {batch, n, k} or {n, k}.
+     *
+     * @return Tensor {batch, m, n} of products, {m, n} if neither operand is a batch.
+     */
+    static TensorParallel<T> batchedMultiplicationAndReturn(const TensorParallel<T>& tensor1, const TensorParallel<T>& tensor2,
+    const bool transpose1 = false, const bool transpose2 = false);
+
+    private:
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Submits tiled kernel calculating c = op(a) * op(b) for every matrix of the batch.
+     *
+     * @param queue queue to submit into.
+     * @param dependencies events the kernel waits for.
+     * @param a left operands, every one is m x k, or k x m if transposed.
+     * @param b right operands, every one is k x n, or n x k if transposed.
+     * @param c results of size m x n, must not overlap the operands.
+     * @param batchJumpA distance between two left operands, zero uses the same one for the whole batch.
+     * @param batchJumpB distance between two right operands, zero uses the same one for the whole batch.
+     *
+     * @return Event of the kernel.
+     */
+    static sycl::event multiply(sycl::queue& queue, const std::vector<sycl::event>& dependencies, const T* a, const bool transposeA,
+    const T* b, const bool transposeB, T* c, const uint64_t batch, const uint64_t m, const uint64_t n, const uint64_t k,
+    const uint64_t batchJumpA, const uint64_t batchJumpB);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Chooses the biggest power of two tile side, whose work-group and two operand tiles fit the device.
+     *
+     * @param device device that runs the kernel.
+     *
+     * @return Tile side.
+     */
+    static uint64_t getTileSide(const sycl::device& device);
 };
 
 }
 
 #include "MatrixParallel.tpp"
 
-#endif
\ No newline at end of file
+#endif
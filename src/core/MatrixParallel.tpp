@@ -1,7 +1,257 @@
+#include <algorithm>
 
+#include <sycl/sycl.hpp>
+
+#include "MatrixParallel.hpp"
 
 namespace gema{
 
+    template <class T>
+    MatrixParallel<T>::MatrixParallel(const uint64_t x, const uint64_t y)
+    : tensor_(LinearContainer<uint64_t>{x, y}){
+
+    }
+
+    template <class T>
+    MatrixParallel<T>::MatrixParallel(const uint64_t x, const uint64_t y, const LinearContainer<T>& newMatrixData)
+    : tensor_(LinearContainer<uint64_t>{x, y}, newMatrixData){
+
+    }
+
+    template <class T>
+    MatrixParallel<T>::MatrixParallel(const TensorParallel<T>& tensor)
+    : tensor_(tensor){
+
+    }
+
+    template <class T>
+    MatrixParallel<T>::MatrixParallel(TensorParallel<T>&& tensor)
+    : tensor_(std::move(tensor)){
+
+    }
+
+    template <class T>
+    MatrixParallel<T>::MatrixParallel(const Matrix<T>& matrix)
+    : tensor_(LinearContainer<uint64_t>{matrix.getNumberOfRows(), matrix.getNumberOfColumns()}){
+
+        tensor_.queue_->memcpy(tensor_.getData(), matrix.getData(), matrix.getNumberOfItems() * sizeof(T)).wait();
+    }
+
+    template <class T>
+    MatrixParallel<T>::MatrixParallel()
+    : tensor_(LinearContainer<uint64_t>{0, 0}){
+
+    }
+
+
+
+    template <class T>
+    const TensorParallel<T>& MatrixParallel<T>::getTensor() const{
+        return tensor_;
+    }
+
+    template <class T>
+    TensorParallel<T>& MatrixParallel<T>::getTensor(){
+        return tensor_;
+    }
+
+    template <class T>
+    uint64_t MatrixParallel<T>::getNumberOfRows() const{
+        return tensor_.getDimensionSizes()[0];
+    }
+
+    template <class T>
+    uint64_t MatrixParallel<T>::getNumberOfColumns() const{
+        return tensor_.getDimensionSizes()[1];
+    }
+
+    template <class T>
+    uint64_t MatrixParallel<T>::getNumberOfItems() const{
+        return tensor_.getNumberOfItems();
+    }
+
+    template <class T>
+    T MatrixParallel<T>::getItem(span_view<uint64_t> coordinates){
+        return tensor_.getItem(coordinates);
+    }
+
+    template <class T>
+    void MatrixParallel<T>::setItem(const T& value, span_view<uint64_t> coordinates){
+        tensor_.setItem(value, coordinates);
+    }
+
+    template <class T>
+    void MatrixParallel<T>::sync() const{
+        tensor_.sync();
+    }
+
+    template <class T>
+    Matrix<T> MatrixParallel<T>::toMatrix() const{
+
+        Matrix<T> matrix(getNumberOfRows(), getNumberOfColumns());
+
+        tensor_.queue_->memcpy(matrix.getData(), tensor_.getData(), getNumberOfItems() * sizeof(T), tensor_.lastEvent_).wait();
+
+        return matrix;
+    }
+
+    template <class T>
+    std::string MatrixParallel<T>::toString() const{
+        return tensor_.toString();
+    }
+
+    template <class U>
+    std::ostream& operator<<(std::ostream& os, const MatrixParallel<U>& matrix){
+        return os << matrix.toString();
+    }
+
+    template <class T>
+    bool MatrixParallel<T>::operator==(const MatrixParallel<T>& otherMatrix) const{
+        return tensor_ == otherMatrix.tensor_;
+    }
+
+    template <class T>
+    bool MatrixParallel<T>::operator!=(const MatrixParallel<T>& otherMatrix) const{
+        return !(*this == otherMatrix);
+    }
+
+    template <class T>
+    void MatrixParallel<T>::matrixMultiplication(const MatrixParallel<T>& otherMatrix){
+        *this = matrixMultiplicationAndReturn(otherMatrix);
+    }
+
+    template <class T>
+    MatrixParallel<T> MatrixParallel<T>::matrixMultiplicationAndReturn(const MatrixParallel<T>& otherMatrix) const{
+        return transposedMultiplicationAndReturn(otherMatrix, false, false);
+    }
+
+    template <class T>
+    MatrixParallel<T> MatrixParallel<T>::transposedMultiplicationAndReturn(const MatrixParallel<T>& otherMatrix,
+    const bool transposeThis, const bool transposeOther) const{
+        return MatrixParallel<T>(batchedMultiplicationAndReturn(tensor_, otherMatrix.tensor_, transposeThis, transposeOther));
+    }
+
+    template <class T>
+    /*static*/ TensorParallel<T> MatrixParallel<T>::batchedMultiplicationAndReturn(const TensorParallel<T>& tensor1,
+    const TensorParallel<T>& tensor2, const bool transpose1, const bool transpose2){
+
+        const auto& dimensionSizes1 = tensor1.getDimensionSizes();
+        const auto& dimensionSizes2 = tensor2.getDimensionSizes();
+
+        // Matrix dimensions are always the last two, the batch dimension is the first one if present
+        const uint64_t rank1 = dimensionSizes1.size();
+        const uint64_t rank2 = dimensionSizes2.size();
+        const uint64_t batch1 = rank1 == 3 ? dimensionSizes1[0] : 1;
+        const uint64_t batch2 = rank2 == 3 ? dimensionSizes2[0] : 1;
+        const uint64_t batch = std::max(batch1, batch2);
+
+        const uint64_t m = transpose1 ? dimensionSizes1[rank1 - 1] : dimensionSizes1[rank1 - 2];
+        const uint64_t k = transpose1 ? dimensionSizes1[rank1 - 2] : dimensionSizes1[rank1 - 1];
+        const uint64_t n = transpose2 ? dimensionSizes2[rank2 - 2] : dimensionSizes2[rank2 - 1];
+
+        TensorParallel<T> result = (rank1 == 3 || rank2 == 3)
+            ? TensorParallel<T>(LinearContainer<uint64_t>{batch, m, n}, tensor1.queue_)
+            : TensorParallel<T>(LinearContainer<uint64_t>{m, n}, tensor1.queue_);
+
+        result.lastEvent_ = multiply(*result.queue_, {result.lastEvent_, tensor1.lastEvent_, tensor2.lastEvent_},
+            tensor1.getData(), transpose1, tensor2.getData(), transpose2, result.getData(), batch, m, n, k,
+            rank1 == 3 ? m * k : 0, rank2 == 3 ? k * n : 0);
+
+        // Operands must not be overwritten before the kernel reads them
+        tensor1.lastEvent_ = result.lastEvent_;
+        tensor2.lastEvent_ = result.lastEvent_;
+
+        return result;
+    }
+
+    template <class T>
+    /*static*/ sycl::event MatrixParallel<T>::multiply(sycl::queue& queue, const std::vector<sycl::event>& dependencies, const T* a,
+    const bool transposeA, const T* b, const bool transposeB, T* c, const uint64_t batch, const uint64_t m, const uint64_t n,
+    const uint64_t k, const uint64_t batchJumpA, const uint64_t batchJumpB){
+
+        if(batch == 0 || m == 0 || n == 0){
+            return queue.submit([&](sycl::handler& h){
+                h.depends_on(dependencies);
+                h.single_task([=](){});
+            });
+        }
+
+        const uint64_t tile = getTileSide(queue.get_device());
+        const uint64_t globalRows = (m + tile - 1) / tile * tile;
+        const uint64_t globalColumns = (n + tile - 1) / tile * tile;
+
+        return queue.submit([&](sycl::handler& h){
+
+            h.depends_on(dependencies);
+
+            // Tiles are stored by rows, tileA[row][p] and tileB[p][column]
+            sycl::local_accessor<T, 1> tileA(sycl::range<1>(tile * tile), h);
+            sycl::local_accessor<T, 1> tileB(sycl::range<1>(tile * tile), h);
+
+            h.parallel_for(sycl::nd_range<3>(sycl::range<3>(batch, globalRows, globalColumns), sycl::range<3>(1, tile, tile)),
+            [=](sycl::nd_item<3> item){
+
+                const uint64_t matrixIndex = item.get_global_id(0);
+                const uint64_t row = item.get_global_id(1);
+                const uint64_t column = item.get_global_id(2);
+                const uint64_t localRow = item.get_local_id(1);
+                const uint64_t localColumn = item.get_local_id(2);
+                const uint64_t firstRow = row - localRow;
+                const uint64_t firstColumn = column - localColumn;
+
+                const T* matrixA = a + matrixIndex * batchJumpA;
+                const T* matrixB = b + matrixIndex * batchJumpB;
+
+                T sum{};
+
+                for(uint64_t p0 = 0; p0 < k; p0 += tile){
+
+                    // Items outside of the operands are loaded as zeros, so the inner loop needs no bounds
+                    if(transposeA){
+                        const uint64_t tileRow = firstRow + localColumn;
+                        const uint64_t p = p0 + localRow;
+                        tileA[localColumn * tile + localRow] = (tileRow < m && p < k) ? matrixA[p * m + tileRow] : T{};
+                    }else{
+                        const uint64_t p = p0 + localColumn;
+                        tileA[localRow * tile + localColumn] = (row < m && p < k) ? matrixA[row * k + p] : T{};
+                    }
+
+                    if(transposeB){
+                        const uint64_t tileColumn = firstColumn + localRow;
+                        const uint64_t p = p0 + localColumn;
+                        tileB[localColumn * tile + localRow] = (tileColumn < n && p < k) ? matrixB[tileColumn * k + p] : T{};
+                    }else{
+                        const uint64_t p = p0 + localRow;
+                        tileB[localRow * tile + localColumn] = (p < k && column < n) ? matrixB[p * n + column] : T{};
+                    }
+
+                    sycl::group_barrier(item.get_group());
+
+                    for(uint64_t p = 0; p < tile; ++p){
+                        sum += tileA[localRow * tile + p] * tileB[p * tile + localColumn];
+                    }
+
+                    sycl::group_barrier(item.get_group());
+                }
+
+                if(row < m && column < n){
+                    c[matrixIndex * m * n + row * n + column] = sum;
+                }
+            });
+        });
+    }
+
+    template <class T>
+    /*static*/ uint64_t MatrixParallel<T>::getTileSide(const sycl::device& device){
+
+        const uint64_t maxWorkGroupSize = device.get_info<sycl::info::device::max_work_group_size>();
+        const uint64_t localMemorySize = device.get_info<sycl::info::device::local_mem_size>();
+
+        uint64_t tile = maxTileSide_;
+        while(tile > 1 && (tile * tile > maxWorkGroupSize || 2 * tile * tile * sizeof(T) > localMemorySize)){
+            tile /= 2;
+        }
 
-    
-}
\ No newline at end of file
+        return tile;
+    }
+}
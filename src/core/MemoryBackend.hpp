@@ -21,6 +21,9 @@ class MemoryBackend {
     using type = MemoryBackend<U>;
     using value_type = T;
 
+    /// Alignment of every allocated block in bytes.
+    constexpr static size_t alignment = Alignment;
+
     MemoryBackend();
 
     MemoryBackend(const MemoryBackend<T, Alignment>& memoryBackend);
@@ -53,6 +53,16 @@ concept MemoryBackendConcept = requires(B b, const B cb, T* p, const T* cp, T va
     { cb.copy_from_host(p, cp, n) } -> std::same_as<void>;
 };
 
+// Alignment of memory allocated by the backend, backends that do not tell it are assumed to align only to the item type
+template <class B>
+constexpr std::size_t memory_backend_alignment_v = [](){
+    if constexpr (requires { B::alignment; }){
+        return static_cast<std::size_t>(B::alignment);
+    }else{
+        return alignof(typename B::value_type);
+    }
+}();
+
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,118 @@
+#ifndef MEMORY_BACKEND_MAPPED_HPP
+#define MEMORY_BACKEND_MAPPED_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "MemoryBackend.hpp"
+
+namespace gema {
+
+/**
+ * @brief File mapped into memory, unmapped when the object is destroyed. Pages are read from the file when they are first
+ * touched, so opening even a huge file costs nothing.
+ */
+class MappedFile {
+
+    std::byte* address_ = nullptr;
+    uint64_t size_ = 0;
+
+    MappedFile(std::byte* address, const uint64_t size);
+
+    public:
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile();
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Maps whole file into memory.
+     *
+     * @param path path to the file.
+     * @param writable if @b true, writes go to the file, otherwise they stay private to the process and the file is opened
+     * read only.
+     *
+     * @return Mapped file or nullptr if the file can not be opened or mapped.
+     */
+    static std::shared_ptr<MappedFile> open(const std::string& path, const bool writable = false);
+
+    std::byte* data() const;
+
+    uint64_t size() const;
+};
+
+/**
+ * @brief Host memory backend, whose first allocation of the mapped item count returns items of mapped file instead of new
+ * memory. Container constructed with this backend therefore sees the file items without copying them. Every other allocation,
+ * for example by copy or resize of the container, is ordinary host memory.
+ *
+ * @par
+ * Copies of the backend share the mapping, which stays mapped as long as any of them exists.
+ *
+ * @tparam T type of items in the file.
+ */
+template<class T>
+class MemoryBackendMapped : public MemoryBackend<T> {
+
+    // Items of the file, shared by copies of the backend, so only one of them hands them out
+    struct Region {
+        std::shared_ptr<MappedFile> file;
+        T* items = nullptr;
+        uint64_t itemCount = 0;
+        std::atomic<bool> claimed = false;
+    };
+
+    std::shared_ptr<Region> region_;
+
+    template <class U>
+    friend class MemoryBackendMapped;
+
+    public:
+
+    template<typename U>
+    using type = MemoryBackendMapped<U>;
+    using value_type = T;
+
+    /// Backend without mapped items, it allocates host memory only.
+    MemoryBackendMapped();
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Makes backend handing out items of mapped file.
+     *
+     * @param file mapped file.
+     * @param byteOffset offset of the first item in the file, must keep the items aligned.
+     * @param itemCount number of items.
+     */
+    MemoryBackendMapped(std::shared_ptr<MappedFile> file, const uint64_t byteOffset, const uint64_t itemCount);
+
+    MemoryBackendMapped(const MemoryBackendMapped<T>& memoryBackend);
+    template <typename U>
+    MemoryBackendMapped(const MemoryBackendMapped<U>& memoryBackend) requires (!std::is_same_v<U, T>);
+    MemoryBackendMapped(MemoryBackendMapped<T>&& memoryBackend) noexcept;
+    MemoryBackendMapped<T>& operator=(const MemoryBackendMapped<T>& memoryBackend);
+    MemoryBackendMapped<T>& operator=(MemoryBackendMapped<T>&& memoryBackend) noexcept;
+
+    T* allocate(size_t n) const;
+    void deallocate(T* pos, size_t n) const;
+
+    // Methods out of concept
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Checks if pointer is inside of mapped items.
+     *
+     * @param pos checked pointer.
+     *
+     * @return Bool @b true if pos points to mapped item.
+     */
+    bool isMapped(const T* pos) const;
+};
+
+}
+
+#include "MemoryBackendMapped.tpp"
+
+#endif
@@ -0,0 +1,130 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "MemoryBackendMapped.hpp"
+
+namespace gema {
+
+    // MAPPED FILE: -----------------------------------------------------------------------------------------------------------
+
+    inline MappedFile::MappedFile(std::byte* address, const uint64_t size)
+    : address_(address), size_(size){
+
+    }
+
+    inline MappedFile::~MappedFile(){
+
+        if(address_ != nullptr){
+            ::munmap(address_, size_);
+        }
+    }
+
+    /*static*/ inline std::shared_ptr<MappedFile> MappedFile::open(const std::string& path, const bool writable){
+
+        const int descriptor = ::open(path.c_str(), writable ? O_RDWR : O_RDONLY);
+        if(descriptor < 0) return nullptr;
+
+        struct stat status;
+        if(::fstat(descriptor, &status) != 0 || status.st_size <= 0){
+            ::close(descriptor);
+            return nullptr;
+        }
+
+        const uint64_t size = static_cast<uint64_t>(status.st_size);
+
+        // Private mapping is copy on write, so items can be changed without touching the file
+        void* address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, writable ? MAP_SHARED : MAP_PRIVATE, descriptor, 0);
+
+        // Mapping holds its own reference to the file
+        ::close(descriptor);
+
+        if(address == MAP_FAILED) return nullptr;
+
+        return std::shared_ptr<MappedFile>(new MappedFile(static_cast<std::byte*>(address), size));
+    }
+
+    inline std::byte* MappedFile::data() const{
+        return address_;
+    }
+
+    inline uint64_t MappedFile::size() const{
+        return size_;
+    }
+
+
+
+    // MEMORY BACKEND MAPPED: -------------------------------------------------------------------------------------------------
+
+    template <class T>
+    MemoryBackendMapped<T>::MemoryBackendMapped(){
+
+    }
+
+    template <class T>
+    MemoryBackendMapped<T>::MemoryBackendMapped(std::shared_ptr<MappedFile> file, const uint64_t byteOffset,
+    const uint64_t itemCount)
+    : region_(std::make_shared<Region>()){
+
+        region_->items = reinterpret_cast<T*>(file->data() + byteOffset);
+        region_->itemCount = itemCount;
+        region_->file = std::move(file);
+    }
+
+    template <class T>
+    MemoryBackendMapped<T>::MemoryBackendMapped(const MemoryBackendMapped<T>& memoryBackend)
+    : MemoryBackend<T>(memoryBackend), region_(memoryBackend.region_){
+
+    }
+
+    // Items of other type are not in the file, so the mapping is not shared
+    template <class T>
+    template <typename U>
+    MemoryBackendMapped<T>::MemoryBackendMapped(const MemoryBackendMapped<U>& memoryBackend)
+    requires (!std::is_same_v<U, T>){
+
+    }
+
+    template <class T>
+    MemoryBackendMapped<T>::MemoryBackendMapped(MemoryBackendMapped<T>&& memoryBackend) noexcept
+    : MemoryBackend<T>(std::move(memoryBackend)), region_(std::move(memoryBackend.region_)){
+
+    }
+
+    template <class T>
+    MemoryBackendMapped<T>& MemoryBackendMapped<T>::operator=(const MemoryBackendMapped<T>& memoryBackend){
+        region_ = memoryBackend.region_;
+        return *this;
+    }
+
+    template <class T>
+    MemoryBackendMapped<T>& MemoryBackendMapped<T>::operator=(MemoryBackendMapped<T>&& memoryBackend) noexcept{
+        region_ = std::move(memoryBackend.region_);
+        return *this;
+    }
+
+    template <class T>
+    T* MemoryBackendMapped<T>::allocate(size_t n) const{
+
+        if(region_ && n == region_->itemCount && !region_->claimed.exchange(true)){
+            return region_->items;
+        }
+
+        return MemoryBackend<T>::allocate(n);
+    }
+
+    template <class T>
+    void MemoryBackendMapped<T>::deallocate(T* pos, size_t n) const{
+
+        // Mapped items are released with the mapping and are never handed out again
+        if(isMapped(pos)) return;
+
+        MemoryBackend<T>::deallocate(pos, n);
+    }
+
+    template <class T>
+    bool MemoryBackendMapped<T>::isMapped(const T* pos) const{
+        return region_ && pos >= region_->items && pos < region_->items + region_->itemCount;
+    }
+}
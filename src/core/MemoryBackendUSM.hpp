@@ -6,6 +6,8 @@
 #include <sycl/sycl.hpp>
 
 #include "MemoryBackend.hpp"
+#include "MemoryPoolUSM.hpp"
+#include "TransferUSM.hpp"
 
 namespace gema {
 
@@ -14,6 +16,14 @@ class MemoryBackendUSM : public MemoryBackend<T, Alignment> {
 
     private:
 
+    // Work-group size of comparison kernels
+    constexpr static uint64_t compareGroupSize_ = 256;
+
+    // Sets *mismatch to nonzero if differs(i) is true for some index i < count. Work-groups started after the mismatch was
+    // found skip their indices. Kernel runs after the dependency event.
+    template <typename F>
+    sycl::event findMismatch(const uint64_t count, uint64_t* mismatch, const sycl::event& dependency, F differs) const;
+
     public:
 
     sycl::queue* queue_ = nullptr;
@@ -33,6 +43,7 @@ class MemoryBackendUSM : public MemoryBackend<T, Alignment> {
     MemoryBackendUSM<T, Kind, Alignment>& operator=(const MemoryBackendUSM<T, Kind, Alignment>& memoryBackend);
     MemoryBackendUSM<T, Kind, Alignment>& operator=(MemoryBackendUSM<T, Kind, Alignment>&& memoryBackend) noexcept;
 
+    // Memory is taken from and returned to the caching pool of the queue (see MemoryPoolUSM)
     T* allocate(size_t n) const;
     void deallocate(T* pos, size_t n) const;
 
@@ -56,6 +67,7 @@ class MemoryBackendUSM : public MemoryBackend<T, Alignment> {
     // template <typename U>
     // MemoryBackendUSM<U, Kind, Alignment> copy_with_type() const;
 
+    // Device memory is copied by chunks through pinned staging buffers (see TransferUSM)
     void copy_to_host(T* dest, const T* src, size_t count) const;
     void copy_from_host(T* dest, const T* src, size_t count) const;
 };
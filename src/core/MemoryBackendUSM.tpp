@@ -1,4 +1,7 @@
+#include <algorithm>
 #include <compare>
+#include <cstdint>
+#include <new>
 #include <type_traits>
 #include <sycl/sycl.hpp>
 
@@ -58,13 +61,24 @@ namespace gema {
 
         //std::size_t bytes = n * sizeof(T);
 
-        return sycl::aligned_alloc<T>(Alignment, n, *queue_, Kind);
+        // Pool throws by itself when it runs out of memory
+        if constexpr (Alignment <= MemoryPoolUSM::blockAlignment){
+            return static_cast<T*>(MemoryPoolUSM::getPool(queue_, Kind).allocate(n * sizeof(T)));
+        }else{
+            T* block = sycl::aligned_alloc<T>(Alignment, n, *queue_, Kind);
+            if(block == nullptr) throw std::bad_alloc();
+            return block;
+        }
     }
 
     template <class T, sycl::usm::alloc Kind, size_t Alignment>
     void MemoryBackendUSM<T, Kind, Alignment>::deallocate(T* pos, size_t n) const {
 
-        sycl::free(pos, *queue_);
+        if constexpr (Alignment <= MemoryPoolUSM::blockAlignment){
+            MemoryPoolUSM::getPool(queue_, Kind).deallocate(pos);
+        }else{
+            sycl::free(pos, *queue_);
+        }
     }
 
     template <class T, sycl::usm::alloc Kind, size_t Alignment>
@@ -265,69 +279,182 @@ namespace gema {
 
         // return finalResult;
 
-        uint64_t* deviceAcumulator = sycl::malloc_device<uint64_t>(1, *queue_);
+        if(count == 0){
+            return true;
+        }
+
+        // Flag is a recycled block of the queue's pool, so no memory is allocated and the host waits only once. Every call
+        // has its own block, so concurrent comparisons on the same device do not wait for each other.
+        MemoryPoolUSM& pool = MemoryPoolUSM::getPool(queue_, sycl::usm::alloc::device);
+        uint64_t* mismatch = static_cast<uint64_t*>(pool.allocate(sizeof(uint64_t)));
+
+        const sycl::event reset = queue_->fill(mismatch, uint64_t(0), 1);
+        sycl::event search;
+
+        bool searched = false;
+
+        // Integers are equal exactly when their bytes are, so whole words are compared no matter the item size
+        if constexpr (std::is_integral_v<T> || std::is_enum_v<T>){
+
+            constexpr uint64_t wordSize = sizeof(uint64_t);
+
+            const bool aligned = reinterpret_cast<std::uintptr_t>(a) % wordSize == 0 &&
+                reinterpret_cast<std::uintptr_t>(b) % wordSize == 0;
+
+            if(aligned){
+
+                const uint64_t bytes = count * sizeof(T);
+                const uint64_t fullWords = bytes / wordSize;
+                const uint64_t* wordsA = reinterpret_cast<const uint64_t*>(a);
+                const uint64_t* wordsB = reinterpret_cast<const uint64_t*>(b);
+                const unsigned char* bytesA = reinterpret_cast<const unsigned char*>(a);
+                const unsigned char* bytesB = reinterpret_cast<const unsigned char*>(b);
+
+                search = findMismatch((bytes + wordSize - 1) / wordSize, mismatch, reset, [=](const uint64_t i){
+
+                    if(i < fullWords){
+                        return wordsA[i] != wordsB[i];
+                    }
+
+                    for(uint64_t j = i * wordSize; j < bytes; ++j){
+                        if(bytesA[j] != bytesB[j]) return true;
+                    }
+                    return false;
+                });
+
+                searched = true;
+            }
+        }
+
+        if(!searched){
+            search = findMismatch(count, mismatch, reset, [=](const uint64_t i){
+                DefaultEquals<T> equals;
+                return !equals(a[i], b[i]);
+            });
+        }
+
+        uint64_t hostMismatch;
+        queue_->memcpy(&hostMismatch, mismatch, sizeof(uint64_t), search).wait();
+
+        pool.deallocate(mismatch);
+
+        return hostMismatch == 0;
+    }
+
+    template <class T, sycl::usm::alloc Kind, size_t Alignment>
+    template <typename F>
+    sycl::event MemoryBackendUSM<T, Kind, Alignment>::findMismatch(const uint64_t count, uint64_t* mismatch, 
+    const sycl::event& dependency, F differs) const {
+
+        const uint64_t maxWorkGroupSize = queue_->get_device().template get_info<sycl::info::device::max_work_group_size>();
+        const uint64_t localSize = std::min<uint64_t>(compareGroupSize_, maxWorkGroupSize);
+        const uint64_t globalSize = (count + localSize - 1) / localSize * localSize;
 
-        uint64_t initialValue = 0;
-        queue_->memcpy(deviceAcumulator, &initialValue, sizeof(uint64_t)).wait();
+        return queue_->submit([&](sycl::handler& h){
 
-        queue_->parallel_for(count, [=](sycl::id<1> idx){
-            size_t i = idx[0];
+            h.depends_on(dependency);
 
-            DefaultEquals<T> equals;
+            sycl::local_accessor<uint64_t, 1> skip(sycl::range<1>(1), h);
 
-            if(!equals(a[i], b[i])){
+            h.parallel_for(sycl::nd_range<1>(globalSize, localSize), [=](sycl::nd_item<1> item){
 
                 sycl::atomic_ref<
                     uint64_t,
                     sycl::memory_order::relaxed,
                     sycl::memory_scope::device,
                     sycl::access::address_space::global_space
-                > atomicFlag(*deviceAcumulator);
+                > flag(*mismatch);
 
-                atomicFlag.store(1);
-            }
+                // Read once by the leader, so the whole group exits together
+                if(item.get_local_id(0) == 0){
+                    skip[0] = flag.load();
+                }
+                sycl::group_barrier(item.get_group());
 
-            // bool result = equals(a[i], b[i]);
-            // if(result != true){
-            //     *workingResult += 1;
-            // }
-        }).wait();
+                const uint64_t i = item.get_global_id(0);
+                if(skip[0] == 0 && i < count && differs(i)){
+                    flag.store(1);
+                }
+            });
+        });
+    }
 
-        uint64_t hostAcumulator;
-        queue_->memcpy(&hostAcumulator, deviceAcumulator, sizeof(uint64_t)).wait();
+    template <class T, sycl::usm::alloc Kind, size_t Alignment>
+    std::partial_ordering MemoryBackendUSM<T, Kind, Alignment>::compare(const T* a, const T* b, size_t count) const {
 
-        bool finalResult = (hostAcumulator == 0);
+        if(count == 0){
+            return std::partial_ordering::equivalent;
+        }
 
-        sycl::free(deviceAcumulator, *queue_);
+        // Index of the first non-equivalent items, count if there is none. It is a recycled block of the queue's pool.
+        MemoryPoolUSM& pool = MemoryPoolUSM::getPool(queue_, sycl::usm::alloc::device);
+        uint64_t* deviceFirst = static_cast<uint64_t*>(pool.allocate(sizeof(uint64_t)));
 
-        return finalResult;
-    }
+        const sycl::event reset = queue_->fill(deviceFirst, uint64_t(count), 1);
 
-    template <class T, sycl::usm::alloc Kind, size_t Alignment>
-    std::partial_ordering MemoryBackendUSM<T, Kind, Alignment>::compare(const T* a, const T* b, size_t count) const {
+        const uint64_t maxWorkGroupSize = queue_->get_device().template get_info<sycl::info::device::max_work_group_size>();
+        const uint64_t localSize = std::min<uint64_t>(compareGroupSize_, maxWorkGroupSize);
+        const uint64_t globalSize = (count + localSize - 1) / localSize * localSize;
 
-        std::partial_ordering* workingResult = sycl::malloc_shared<std::partial_ordering>(1, *queue_);
-        *workingResult = std::partial_ordering::equivalent;
+        const sycl::event search = queue_->submit([&](sycl::handler& h){
 
-        queue_->submit([&](sycl::handler& h){
-            h.single_task([=](){
-                
-                DefaultOrder<T> order;
-                for(uint64_t i = 0; i < count; i++){
+            h.depends_on(reset);
+
+            // First non-equivalent index found by the group and flag telling the group to skip its items
+            sycl::local_accessor<uint64_t, 1> groupState(sycl::range<1>(2), h);
+
+            h.parallel_for(sycl::nd_range<1>(globalSize, localSize), [=](sycl::nd_item<1> item){
+
+                const uint64_t i = item.get_global_id(0);
+                const bool isLeader = item.get_local_id(0) == 0;
+
+                sycl::atomic_ref<
+                    uint64_t,
+                    sycl::memory_order::relaxed,
+                    sycl::memory_scope::device,
+                    sycl::access::address_space::global_space
+                > globalFirst(*deviceFirst);
+
+                sycl::atomic_ref<
+                    uint64_t,
+                    sycl::memory_order::relaxed,
+                    sycl::memory_scope::work_group,
+                    sycl::access::address_space::local_space
+                > groupFirst(groupState[0]);
+
+                // Groups after already found difference cannot find the first one, so they do not read their items
+                if(isLeader){
+                    groupState[0] = count;
+                    groupState[1] = globalFirst.load() < i;
+                }
+                sycl::group_barrier(item.get_group());
 
-                    std::partial_ordering result = order(a[i], b[i]);
-                    if(result != std::partial_ordering::equivalent){
-                        *workingResult = result;
-                        return;
+                if(!groupState[1] && i < count){
+                    DefaultOrder<T> order;
+                    if(order(a[i], b[i]) != std::partial_ordering::equivalent){
+                        groupFirst.fetch_min(i);
                     }
                 }
+                sycl::group_barrier(item.get_group());
+
+                if(isLeader && groupState[0] < count){
+                    globalFirst.fetch_min(groupState[0]);
+                }
             });
-        }).wait();
+        });
 
-        std::partial_ordering finalResult = *workingResult;
-        sycl::free(workingResult, *queue_);
+        uint64_t first;
+        queue_->memcpy(&first, deviceFirst, sizeof(uint64_t), search).wait();
 
-        return finalResult;
+        pool.deallocate(deviceFirst);
+
+        if(first == count){
+            return std::partial_ordering::equivalent;
+        }
+
+        // Only the first different pair of items decides the order
+        DefaultOrder<T> order;
+        return order(get_value(a, first), get_value(b, first));
 
 
 
@@ -365,33 +492,50 @@ namespace gema {
     template <class T, sycl::usm::alloc Kind, size_t Alignment>
     void MemoryBackendUSM<T, Kind, Alignment>::set_value(T* dest, const uint64_t index, const T& value) const {
 
-        T* placeToSave = dest + index;
+        // Single item is copied directly, only types that can not be copied by bytes need a kernel
+        if constexpr (std::is_trivially_copyable_v<T>){
 
-        queue_->submit([&](sycl::handler& h){
-            h.single_task([=](){
-                *placeToSave = value;
-            });
-        }).wait();
+            queue_->memcpy(dest + index, &value, sizeof(T)).wait();
+
+        }else{
+
+            T* placeToSave = dest + index;
+
+            queue_->submit([&](sycl::handler& h){
+                h.single_task([=](){
+                    *placeToSave = value;
+                });
+            }).wait();
+        }
     }
 
     template <class T, sycl::usm::alloc Kind, size_t Alignment>
     T MemoryBackendUSM<T, Kind, Alignment>::get_value(const T* dest, const uint64_t index) const {
 
-        T* sharedTmp = sycl::malloc_shared<T>(1, *queue_);
+        if constexpr (std::is_trivially_copyable_v<T>){
 
-        queue_->submit([&](sycl::handler& h){
-            h.single_task([=](){
-                new (sharedTmp) T(dest[index]);
-            });
-        }).wait();
+            T result;
+            queue_->memcpy(&result, dest + index, sizeof(T)).wait();
+            return result;
 
-        T result = *sharedTmp;
+        }else{
 
-        std::destroy_at(sharedTmp);
+            T* sharedTmp = sycl::malloc_shared<T>(1, *queue_);
 
-        sycl::free(sharedTmp, *queue_);
+            queue_->submit([&](sycl::handler& h){
+                h.single_task([=](){
+                    new (sharedTmp) T(dest[index]);
+                });
+            }).wait();
 
-        return result;
+            T result = *sharedTmp;
+
+            std::destroy_at(sharedTmp);
+
+            sycl::free(sharedTmp, *queue_);
+
+            return result;
+        }
     }
 
     
@@ -406,7 +550,9 @@ namespace gema {
     template <class T, sycl::usm::alloc Kind, size_t Alignment>
     void MemoryBackendUSM<T, Kind, Alignment>::copy_to_host(T* dest, const T* src, size_t count) const {
 
-        if constexpr(std::is_trivially_copyable_v<T>) {
+        if constexpr(std::is_trivially_copyable_v<T> && Kind == sycl::usm::alloc::device) {
+            TransferUSM::download(*queue_, dest, src, count);
+        } else if constexpr(std::is_trivially_copyable_v<T>) {
             queue_->memcpy(dest, src, count * sizeof(T)).wait();
         } else {
 
@@ -439,7 +585,9 @@ namespace gema {
     void MemoryBackendUSM<T, Kind, Alignment>::copy_from_host(T* dest, const T* src, size_t count) const {
         //queue_->memcpy(dest, src, count * sizeof(T)).wait();
 
-        if constexpr(std::is_trivially_copyable_v<T>) {
+        if constexpr(std::is_trivially_copyable_v<T> && Kind == sycl::usm::alloc::device) {
+            TransferUSM::upload(*queue_, dest, src, count).wait();
+        } else if constexpr(std::is_trivially_copyable_v<T>) {
             queue_->memcpy(dest, src, count * sizeof(T)).wait();
         } else {
 
@@ -0,0 +1,129 @@
+#ifndef MEMORY_POOL_USM_HPP
+#define MEMORY_POOL_USM_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <sycl/sycl.hpp>
+
+namespace gema {
+
+/// Counters of one memory pool, all sizes are in bytes.
+struct MemoryPoolStatistics {
+    /// Allocations served by recycled block.
+    uint64_t hits = 0;
+    /// Allocations that had to call sycl::aligned_alloc.
+    uint64_t misses = 0;
+    /// Bytes of blocks currently handed out.
+    uint64_t bytesInUse = 0;
+    /// Bytes of freed blocks kept for reuse.
+    uint64_t bytesCached = 0;
+    /// Maximum of bytes allocated from the runtime at once (in use and cached together).
+    uint64_t highWater = 0;
+};
+
+/**
+ * @brief Caching allocator of USM memory, there is one pool per context, device and USM allocation kind, shared by all
+ * queues of them. Freed blocks are not returned
+ * to the runtime but kept in free lists by size class, so following allocation of similar size reuses them. Size classes
+ * are four per power of two, so at most a quarter of block is wasted.
+ *
+ * @par
+ * Blocks are allocated and freed through device and context of the queue, copies of them are kept in the pool, so the pool
+ * can be trimmed even after the queue itself no longer exists.
+ *
+ * @note Pool does not track kernels, freed block must not be in use by any pending kernel, which is the same requirement
+ * sycl::free has.
+ */
+class MemoryPoolUSM {
+
+    sycl::device device_;
+    sycl::context context_;
+    sycl::usm::alloc kind_;
+
+    mutable std::mutex mutex_;
+
+    /// Free blocks by their size class.
+    std::unordered_map<size_t, std::vector<void*>> freeBlocks_;
+    /// Size classes of blocks that are handed out.
+    std::unordered_map<void*, size_t> usedBlocks_;
+
+    MemoryPoolStatistics statistics_;
+
+    public:
+
+    /// Alignment of every block, allocations requiring bigger alignment can not be served by the pool.
+    constexpr static size_t blockAlignment = 256;
+
+    MemoryPoolUSM(const sycl::queue& queue, const sycl::usm::alloc kind);
+
+    MemoryPoolUSM(const MemoryPoolUSM&) = delete;
+    MemoryPoolUSM& operator=(const MemoryPoolUSM&) = delete;
+
+    ~MemoryPoolUSM();
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Gets the pool for context and device of given queue and allocation kind, creates it on first use. Pool is not
+     * tied to the queue itself, so queue created later at the same address gets pool of its own context.
+     *
+     * @param queue queue whose device and context are used for allocation.
+     * @param kind USM allocation kind.
+     *
+     * @return Reference to the pool, which lives until the end of the program.
+     */
+    static MemoryPoolUSM& getPool(const sycl::queue* queue, const sycl::usm::alloc kind);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Frees cached blocks of every pool.
+     */
+    static void trimAll();
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Gets block of at least given size, recycled one if possible. Throws std::bad_alloc if the runtime can not
+     * allocate it even after cached blocks were freed.
+     *
+     * @param bytes requested size, zero returns nullptr.
+     *
+     * @return Pointer to block aligned to blockAlignment.
+     */
+    void* allocate(const size_t bytes);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Returns block to the pool for later reuse.
+     *
+     * @param pointer pointer obtained from allocate of this pool, nullptr is ignored.
+     */
+    void deallocate(void* pointer);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Frees all cached blocks back to the runtime. Blocks in use are not affected.
+     */
+    void trim();
+
+    MemoryPoolStatistics getStatistics() const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Rounds size up to its size class, classes are 256 bytes and then four per power of two.
+     *
+     * @param bytes requested size.
+     *
+     * @return Size of the block that serves the request.
+     */
+    static size_t getSizeClass(const size_t bytes);
+
+    private:
+
+    static std::mutex& registryMutex();
+    // Few contexts and devices are ever used, so pools are found by plain search
+    static std::vector<std::unique_ptr<MemoryPoolUSM>>& registry();
+};
+
+}
+
+#include "MemoryPoolUSM.tpp"
+
+#endif
@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <bit>
+#include <new>
+
+#include <sycl/sycl.hpp>
+
+#include "MemoryPoolUSM.hpp"
+
+namespace gema {
+
+    inline MemoryPoolUSM::MemoryPoolUSM(const sycl::queue& queue, const sycl::usm::alloc kind)
+    : device_(queue.get_device()), context_(queue.get_context()), kind_(kind){
+
+    }
+
+    inline MemoryPoolUSM::~MemoryPoolUSM(){
+        trim();
+    }
+
+    /*static*/ inline MemoryPoolUSM& MemoryPoolUSM::getPool(const sycl::queue* queue, const sycl::usm::alloc kind){
+
+        const sycl::context context = queue->get_context();
+        const sycl::device device = queue->get_device();
+
+        std::lock_guard<std::mutex> lock(registryMutex());
+
+        for(const std::unique_ptr<MemoryPoolUSM>& pool : registry()){
+            if(pool->kind_ == kind && pool->context_ == context && pool->device_ == device) return *pool;
+        }
+
+        return *registry().emplace_back(std::make_unique<MemoryPoolUSM>(*queue, kind));
+    }
+
+    /*static*/ inline void MemoryPoolUSM::trimAll(){
+
+        std::lock_guard<std::mutex> lock(registryMutex());
+
+        for(const std::unique_ptr<MemoryPoolUSM>& pool : registry()){
+            pool->trim();
+        }
+    }
+
+    inline void* MemoryPoolUSM::allocate(const size_t bytes){
+
+        if(bytes == 0) return nullptr;
+
+        const size_t sizeClass = getSizeClass(bytes);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        void* block = nullptr;
+        auto freeList = freeBlocks_.find(sizeClass);
+
+        if(freeList != freeBlocks_.end() && !freeList->second.empty()){
+
+            block = freeList->second.back();
+            freeList->second.pop_back();
+
+            statistics_.bytesCached -= sizeClass;
+            ++statistics_.hits;
+
+        }else{
+
+            block = sycl::aligned_alloc(blockAlignment, sizeClass, device_, context_, kind_);
+
+            // Cached blocks are the first thing to give up when the device runs out of memory
+            if(block == nullptr && statistics_.bytesCached > 0){
+                for(auto& [cachedClass, blocks] : freeBlocks_){
+                    for(void* cachedBlock : blocks){
+                        sycl::free(cachedBlock, context_);
+                    }
+                    blocks.clear();
+                }
+                statistics_.bytesCached = 0;
+                block = sycl::aligned_alloc(blockAlignment, sizeClass, device_, context_, kind_);
+            }
+
+            if(block == nullptr) throw std::bad_alloc();
+
+            ++statistics_.misses;
+        }
+
+        usedBlocks_.emplace(block, sizeClass);
+        statistics_.bytesInUse += sizeClass;
+        statistics_.highWater = std::max(statistics_.highWater, statistics_.bytesInUse + statistics_.bytesCached);
+
+        return block;
+    }
+
+    inline void MemoryPoolUSM::deallocate(void* pointer){
+
+        if(pointer == nullptr) return;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto usedBlock = usedBlocks_.find(pointer);
+
+        // Not allocated by this pool
+        if(usedBlock == usedBlocks_.end()){
+            sycl::free(pointer, context_);
+            return;
+        }
+
+        const size_t sizeClass = usedBlock->second;
+        usedBlocks_.erase(usedBlock);
+
+        freeBlocks_[sizeClass].push_back(pointer);
+
+        statistics_.bytesInUse -= sizeClass;
+        statistics_.bytesCached += sizeClass;
+    }
+
+    inline void MemoryPoolUSM::trim(){
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        for(auto& [sizeClass, blocks] : freeBlocks_){
+            for(void* block : blocks){
+                sycl::free(block, context_);
+            }
+        }
+
+        freeBlocks_.clear();
+        statistics_.bytesCached = 0;
+    }
+
+    inline MemoryPoolStatistics MemoryPoolUSM::getStatistics() const{
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        return statistics_;
+    }
+
+    /*static*/ inline size_t MemoryPoolUSM::getSizeClass(const size_t bytes){
+
+        constexpr size_t minimalClass = 256;
+        if(bytes <= minimalClass) return minimalClass;
+
+        // Four classes between every two powers of two
+        const size_t step = std::bit_floor(bytes) / 4;
+        return (bytes + step - 1) / step * step;
+    }
+
+    // Registry is never destroyed, tensors with static storage duration may still return their memory during exit
+    /*static*/ inline std::mutex& MemoryPoolUSM::registryMutex(){
+        static std::mutex* mutex = new std::mutex();
+        return *mutex;
+    }
+
+    /*static*/ inline std::vector<std::unique_ptr<MemoryPoolUSM>>& MemoryPoolUSM::registry(){
+        static auto* pools = new std::vector<std::unique_ptr<MemoryPoolUSM>>();
+        return *pools;
+    }
+}
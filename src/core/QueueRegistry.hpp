@@ -0,0 +1,110 @@
+#ifndef QUEUE_REGISTRY_HPP
+#define QUEUE_REGISTRY_HPP
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include <sycl/sycl.hpp>
+
+namespace gema {
+
+/// Kinds of queues the registry creates.
+enum class QueueKind : uint8_t {
+    /// Kernels run in order of submission, the queue TensorParallel uses by default.
+    inOrder,
+    /// Kernels without dependency between them may run at once, order is kept only by events of tensors.
+    outOfOrder,
+    /// In-order queue with profiling enabled, events of its kernels give their start and end times.
+    profiling
+};
+
+/**
+ * @brief Owner of queues that tensors are bound to. There is one context per device, every queue of the same device is
+ * created in it, so tensors on different queues of one device can be operands of the same operation and their kernels
+ * wait for each other through events. Queues live until the end of the program.
+ *
+ * @par
+ * The default queue of TensorParallel is the shared in-order queue of the default device. Independent work, for example
+ * requests served by separate threads, gets its own queue from createQueue or getThreadQueue, so it is not serialized
+ * behind kernels of others.
+ */
+class QueueRegistry {
+
+    // Number of values of QueueKind
+    constexpr static uint64_t queueKindCount_ = 3;
+
+    struct DeviceEntry {
+        sycl::device device;
+        sycl::context context;
+        // Queues returned by getQueue, created on first use
+        std::array<sycl::queue*, queueKindCount_> sharedQueues{};
+    };
+
+    static std::mutex& registryMutex();
+
+    // Deques keep addresses of their items, so pointers to queues stay valid when new ones are added
+    static std::deque<sycl::queue>& queues();
+    static std::deque<DeviceEntry>& devices();
+
+    // Caller must hold the lock of registryMutex
+    static DeviceEntry& getDeviceEntry(const sycl::device& device);
+    static sycl::queue* makeQueue(DeviceEntry& entry, const QueueKind kind);
+
+    static const sycl::device& getDefaultDevice();
+
+    public:
+
+    QueueRegistry() = delete;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Gets queue of given kind shared by everyone who asks for it, creates it on first use.
+     *
+     * @param device device of the queue.
+     * @param kind kind of the queue.
+     *
+     * @return Pointer to the queue, which lives until the end of the program.
+     */
+    static sycl::queue* getQueue(const sycl::device& device, const QueueKind kind = QueueKind::inOrder);
+
+    static sycl::queue* getQueue(const QueueKind kind = QueueKind::inOrder);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Creates new queue, that is not returned to anyone else.
+     *
+     * @param device device of the queue.
+     * @param kind kind of the queue.
+     *
+     * @return Pointer to the queue, which lives until the end of the program.
+     */
+    static sycl::queue* createQueue(const sycl::device& device, const QueueKind kind = QueueKind::inOrder);
+
+    static sycl::queue* createQueue(const QueueKind kind = QueueKind::inOrder);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Gets queue of the default device owned by the calling thread, each thread gets its own one on first use. Queue
+     * outlives the thread, so tensors bound to it can be passed to other threads.
+     *
+     * @param kind kind of the queue.
+     *
+     * @return Pointer to the queue, which lives until the end of the program.
+     */
+    static sycl::queue* getThreadQueue(const QueueKind kind = QueueKind::inOrder);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Gets context in which all queues of the device are created.
+     *
+     * @param device the device.
+     *
+     * @return Copy of the context.
+     */
+    static sycl::context getContext(const sycl::device& device);
+};
+
+}
+
+#include "QueueRegistry.tpp"
+
+#endif
@@ -0,0 +1,92 @@
+#include "QueueRegistry.hpp"
+
+namespace gema {
+
+    /*static*/ inline std::mutex& QueueRegistry::registryMutex(){
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    /*static*/ inline std::deque<sycl::queue>& QueueRegistry::queues(){
+        static std::deque<sycl::queue> queues;
+        return queues;
+    }
+
+    /*static*/ inline std::deque<QueueRegistry::DeviceEntry>& QueueRegistry::devices(){
+        static std::deque<DeviceEntry> devices;
+        return devices;
+    }
+
+    /*static*/ inline QueueRegistry::DeviceEntry& QueueRegistry::getDeviceEntry(const sycl::device& device){
+
+        // Few devices are ever used, so plain search is enough
+        for(DeviceEntry& entry : devices()){
+            if(entry.device == device) return entry;
+        }
+
+        return devices().emplace_back(DeviceEntry{device, sycl::context(device)});
+    }
+
+    /*static*/ inline sycl::queue* QueueRegistry::makeQueue(DeviceEntry& entry, const QueueKind kind){
+
+        switch(kind){
+            case QueueKind::outOfOrder:
+                return &queues().emplace_back(entry.context, entry.device);
+            case QueueKind::profiling:
+                return &queues().emplace_back(entry.context, entry.device,
+                    sycl::property_list{sycl::property::queue::in_order{}, sycl::property::queue::enable_profiling{}});
+            default:
+                return &queues().emplace_back(entry.context, entry.device, sycl::property_list{sycl::property::queue::in_order{}});
+        }
+    }
+
+    /*static*/ inline const sycl::device& QueueRegistry::getDefaultDevice(){
+        static const sycl::device device{sycl::default_selector_v};
+        return device;
+    }
+
+    /*static*/ inline sycl::queue* QueueRegistry::getQueue(const sycl::device& device, const QueueKind kind){
+
+        std::lock_guard<std::mutex> lock(registryMutex());
+
+        DeviceEntry& entry = getDeviceEntry(device);
+        sycl::queue*& queue = entry.sharedQueues[static_cast<uint64_t>(kind)];
+        if(queue == nullptr){
+            queue = makeQueue(entry, kind);
+        }
+
+        return queue;
+    }
+
+    /*static*/ inline sycl::queue* QueueRegistry::getQueue(const QueueKind kind){
+        return getQueue(getDefaultDevice(), kind);
+    }
+
+    /*static*/ inline sycl::queue* QueueRegistry::createQueue(const sycl::device& device, const QueueKind kind){
+
+        std::lock_guard<std::mutex> lock(registryMutex());
+        return makeQueue(getDeviceEntry(device), kind);
+    }
+
+    /*static*/ inline sycl::queue* QueueRegistry::createQueue(const QueueKind kind){
+        return createQueue(getDefaultDevice(), kind);
+    }
+
+    /*static*/ inline sycl::queue* QueueRegistry::getThreadQueue(const QueueKind kind){
+
+        thread_local std::array<sycl::queue*, queueKindCount_> threadQueues{};
+
+        sycl::queue*& queue = threadQueues[static_cast<uint64_t>(kind)];
+        if(queue == nullptr){
+            queue = createQueue(kind);
+        }
+
+        return queue;
+    }
+
+    /*static*/ inline sycl::context QueueRegistry::getContext(const sycl::device& device){
+
+        std::lock_guard<std::mutex> lock(registryMutex());
+        return getDeviceEntry(device).context;
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+// SIMD evaluation is used whenever the standard library provides std::experimental::simd, defining GEMA_NO_SIMD turns it off
+// and every expression is evaluated item by item.
+#if !defined(GEMA_NO_SIMD) && __has_include(<experimental/simd>)
+    #include <experimental/simd>
+    #define GEMA_SIMD 1
+#endif
+
+namespace gema {
+
+#ifdef GEMA_SIMD
+
+/// Pack of items filling one vector register of the widest instruction set the code is compiled for.
+template <class T>
+using simd_pack = std::experimental::native_simd<T>;
+
+/// Load and store of packs from memory aligned to the pack size.
+inline constexpr auto simd_aligned = std::experimental::vector_aligned;
+/// Load and store of packs from memory aligned only to the item type.
+inline constexpr auto simd_unaligned = std::experimental::element_aligned;
+
+/// Items that can be loaded into SIMD packs, items of other types are always processed one by one.
+template <class T>
+concept simd_item = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+/// Checks if expression node or leaf can evaluate whole pack of items of its own value type at once.
+template <typename X>
+concept simd_operand = simd_item<typename X::value_type> && requires (const X& x) {
+    { x.evaluatePack(uint64_t{0}, simd_unaligned) } -> std::same_as<simd_pack<typename X::value_type>>;
+};
+
+/// Checks if operation can be called on packs of items of all operands at once.
+template <typename Operation, typename... Operands>
+concept simd_operation = (simd_operand<Operands> && ...) &&
+    std::is_invocable_v<const Operation&, simd_pack<typename Operands::value_type>...>;
+
+// Checks if pointer is aligned for aligned loads and stores of packs
+template <class T>
+bool isPackAligned(const T* pointer){
+    return reinterpret_cast<std::uintptr_t>(pointer) % std::experimental::memory_alignment_v<simd_pack<T>> == 0;
+}
+
+#endif
+
+}
+
+#endif
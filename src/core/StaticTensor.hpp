@@ -0,0 +1,252 @@
+#ifndef STATIC_TENSOR_HPP
+#define STATIC_TENSOR_HPP
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <utility>
+
+#include "LinearContainer.hpp"
+#include "MemoryBackend.hpp"
+#include "MemoryBackendConcept.hpp"
+#include "Tensor.hpp"
+
+namespace gema{
+
+/// Extent of StaticShape, that is not known at compile time and is given to the constructor instead.
+inline constexpr uint64_t dynamic_extent = std::dynamic_extent;
+
+// ============================================================================================================================
+/**
+ * @brief Shape of tensor with number of dimensions known at compile time, each extent is either compile time constant
+ * or dynamic_extent. All extents are stored inline in the object, so there is no allocation and index math loops over
+ * constant number of dimensions, which compiler unrolls, with constant extents folded into the code.
+ *
+ * @par
+ * Items are in row-major order like in Tensor, the last coordinate is the fastest one.
+ *
+ * @tparam Extents size of every dimension, dynamic_extent for sizes given at runtime.
+ */
+template <uint64_t... Extents>
+class StaticShape{
+
+    public:
+
+    /// Number of dimensions.
+    constexpr static uint64_t rank = sizeof...(Extents);
+
+    /// Number of extents that are given at runtime.
+    constexpr static uint64_t dynamicRank = ((Extents == dynamic_extent ? 1 : 0) + ... + 0);
+
+    using coordinates_type = std::array<uint64_t, rank>;
+
+    private:
+
+    constexpr static coordinates_type staticExtents_{Extents...};
+
+    // All extents, static ones as well, so runtime access does not need to distinguish them
+    coordinates_type extents_{(Extents == dynamic_extent ? 0 : Extents)...};
+
+    public:
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Makes shape, dynamic extents are zero if not given.
+     *
+     * @param dynamicExtents sizes of the dynamic dimensions in their order, either none or all of them.
+     */
+    template <std::convertible_to<uint64_t>... E>
+    constexpr explicit StaticShape(const E... dynamicExtents) requires (sizeof...(E) == dynamicRank || sizeof...(E) == 0);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Makes shape from sizes of all dimensions. Throws std::invalid_argument if their number is not rank or if a size
+     * differs from its static extent.
+     *
+     * @param dimensionSizes sizes of all rank dimensions.
+     *
+     * @return New shape.
+     */
+    static StaticShape fromDimensionSizes(span_view<uint64_t> dimensionSizes);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Gets size of dimension known at compile time, so static extent is constant expression.
+     *
+     * @tparam D index of the dimension.
+     *
+     * @return Size of the dimension.
+     */
+    template <uint64_t D>
+    constexpr uint64_t extent() const requires (D < rank);
+
+    constexpr uint64_t extent(const uint64_t dimension) const;
+
+    constexpr const coordinates_type& getDimensionSizes() const;
+
+    constexpr uint64_t getNumberOfItems() const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Calculates index of item in data from its coordinates.
+     *
+     * @param coordinates coordinates of the item.
+     *
+     * @return Index of the item.
+     */
+    constexpr uint64_t getIndex(const coordinates_type& coordinates) const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Calculates coordinates of item from its index in data, inverse of getIndex.
+     *
+     * @param itemIndex index of the item.
+     *
+     * @return Coordinates of the item.
+     */
+    constexpr coordinates_type getCoords(uint64_t itemIndex) const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Moves coordinates to the next item in the order of data.
+     *
+     * @param coordinates coordinates that are incremented.
+     *
+     * @return Bool @b true if the coordinates overflowed back to all zeros.
+     */
+    constexpr bool incrementCoords(coordinates_type& coordinates) const;
+
+    constexpr bool isValidCoordinates(const coordinates_type& coordinates) const;
+
+    constexpr bool operator==(const StaticShape& otherShape) const = default;
+};
+
+// Checks if type is StaticShape.
+template <typename S>
+struct is_static_shape : std::false_type {};
+
+template <uint64_t... Extents>
+struct is_static_shape<StaticShape<Extents...>> : std::true_type {};
+
+template <typename S>
+concept static_shape = is_static_shape<S>::value;
+
+namespace detail{
+
+template <uint64_t Rank, uint64_t... Extents>
+struct dynamic_shape { using type = typename dynamic_shape<Rank - 1, dynamic_extent, Extents...>::type; };
+
+template <uint64_t... Extents>
+struct dynamic_shape<0, Extents...> { using type = StaticShape<Extents...>; };
+
+}
+
+/// Shape of given number of dimensions with all extents given at runtime.
+template <uint64_t Rank>
+using DynamicShape = typename detail::dynamic_shape<Rank>::type;
+
+// ============================================================================================================================
+/**
+ * @brief Tensor with shape fixed at compile time (rank always, extents optionally). Shape lives inside the object, so
+ * accessing item by coordinates is a few multiplications without any loop over dimensions or reading of metadata from
+ * memory. Meant for hot loops accessing items one by one, whole tensor operations are available after conversion to Tensor.
+ *
+ * @par
+ * Example
+ * @par
+ * StaticTensor<float, StaticShape<3, dynamic_extent, 4>> tensor(StaticShape<3, dynamic_extent, 4>(n));
+ * @par
+ * RankedTensor<float, 3> tensor(DynamicShape<3>(x, y, z));
+ *
+ * @tparam T type of items.
+ * @tparam Shape StaticShape of the tensor.
+ * @tparam DataMB memory backend of data.
+ */
+template <class T, static_shape Shape, MemoryBackendConcept<T> DataMB = MemoryBackend<T>>
+class StaticTensor{
+
+    public:
+
+    using value_type = T;
+    using shape_type = Shape;
+    using coordinates_type = typename Shape::coordinates_type;
+
+    private:
+
+    Shape shape_;
+    LinearContainer<T, DataMB> tensor_;
+
+    public:
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Makes tensor of given shape with default initialized items.
+     *
+     * @param shape shape of the tensor, may be omitted if all extents are static.
+     */
+    explicit StaticTensor(const Shape& shape = Shape());
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Makes tensor of given shape and fills it with data.
+     *
+     * @param shape shape of the tensor.
+     * @param newData items in the order of data, as many as the shape has.
+     */
+    StaticTensor(const Shape& shape, const LinearContainer<T>& newData);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Copies tensor with runtime shape, its number of dimensions must be rank and static extents must match. Throws
+     * std::invalid_argument otherwise.
+     *
+     * @param tensor copied tensor.
+     */
+    explicit StaticTensor(const Tensor<T>& tensor);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Copies the tensor into tensor with runtime shape, which has all whole tensor operations.
+     *
+     * @return New tensor of the same dimension sizes and items.
+     */
+    Tensor<T> toTensor() const;
+
+    const Shape& getShape() const;
+
+    const coordinates_type& getDimensionSizes() const;
+
+    constexpr static uint64_t getNumberOfDimensions();
+
+    uint64_t getNumberOfItems() const;
+
+    T& getItem(const coordinates_type& coordinates);
+
+    const T& getItem(const coordinates_type& coordinates) const;
+
+    void setItem(const T& value, const coordinates_type& coordinates);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Accesses item by coordinates given as separate arguments, one per dimension.
+     *
+     * @param coordinates coordinates of the item.
+     *
+     * @return Reference to the item.
+     */
+    template <std::convertible_to<uint64_t>... I>
+    T& operator()(const I... coordinates) requires (sizeof...(I) == Shape::rank);
+
+    template <std::convertible_to<uint64_t>... I>
+    const T& operator()(const I... coordinates) const requires (sizeof...(I) == Shape::rank);
+
+    T* getData();
+    const T* getData() const;
+
+    void fillWith(const T& fill);
+
+    std::string toString() const;
+
+    bool operator==(const StaticTensor& otherTensor) const;
+};
+
+/// StaticTensor with rank known at compile time and all extents given at runtime.
+template <class T, uint64_t Rank, MemoryBackendConcept<T> DataMB = MemoryBackend<T>>
+using RankedTensor = StaticTensor<T, DynamicShape<Rank>, DataMB>;
+
+}
+
+#include "StaticTensor.tpp"
+
+#endif
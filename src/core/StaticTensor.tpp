@@ -0,0 +1,227 @@
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "StaticTensor.hpp"
+
+namespace gema{
+
+    // STATIC SHAPE: ----------------------------------------------------------------------------------------------------------
+
+    template <uint64_t... Extents>
+    template <std::convertible_to<uint64_t>... E>
+    constexpr StaticShape<Extents...>::StaticShape(const E... dynamicExtents)
+    requires (sizeof...(E) == dynamicRank || sizeof...(E) == 0){
+
+        if constexpr (sizeof...(E) > 0){
+
+            const std::array<uint64_t, dynamicRank> given{static_cast<uint64_t>(dynamicExtents)...};
+
+            uint64_t next = 0;
+            for(uint64_t d = 0; d < rank; ++d){
+                if(staticExtents_[d] == dynamic_extent){
+                    extents_[d] = given[next++];
+                }
+            }
+        }
+    }
+
+    template <uint64_t... Extents>
+    /*static*/ StaticShape<Extents...> StaticShape<Extents...>::fromDimensionSizes(span_view<uint64_t> dimensionSizes){
+
+        if(dimensionSizes.size() != rank){
+            throw std::invalid_argument("Number of dimensions does not match rank of static shape");
+        }
+
+        StaticShape<Extents...> shape;
+        for(uint64_t d = 0; d < rank; ++d){
+            if(staticExtents_[d] == dynamic_extent){
+                shape.extents_[d] = dimensionSizes[d];
+            }else if(staticExtents_[d] != dimensionSizes[d]){
+                throw std::invalid_argument("Dimension size does not match static extent");
+            }
+        }
+        return shape;
+    }
+
+    template <uint64_t... Extents>
+    template <uint64_t D>
+    constexpr uint64_t StaticShape<Extents...>::extent() const requires (D < rank){
+
+        if constexpr (staticExtents_[D] != dynamic_extent){
+            return staticExtents_[D];
+        }else{
+            return extents_[D];
+        }
+    }
+
+    template <uint64_t... Extents>
+    constexpr uint64_t StaticShape<Extents...>::extent(const uint64_t dimension) const{
+        return extents_[dimension];
+    }
+
+    template <uint64_t... Extents>
+    constexpr const typename StaticShape<Extents...>::coordinates_type& StaticShape<Extents...>::getDimensionSizes() const{
+        return extents_;
+    }
+
+    template <uint64_t... Extents>
+    constexpr uint64_t StaticShape<Extents...>::getNumberOfItems() const{
+
+        return [this]<uint64_t... D>(std::integer_sequence<uint64_t, D...>){
+            return (uint64_t(1) * ... * extent<D>());
+        }(std::make_integer_sequence<uint64_t, rank>());
+    }
+
+    template <uint64_t... Extents>
+    constexpr uint64_t StaticShape<Extents...>::getIndex(const coordinates_type& coordinates) const{
+
+        // Horner scheme unrolled over dimensions, the same order as Tensor::getIndex
+        uint64_t itemIndex = 0;
+        [&]<uint64_t... D>(std::integer_sequence<uint64_t, D...>){
+            ((itemIndex = itemIndex * extent<D>() + coordinates[D]), ...);
+        }(std::make_integer_sequence<uint64_t, rank>());
+
+        return itemIndex;
+    }
+
+    template <uint64_t... Extents>
+    constexpr typename StaticShape<Extents...>::coordinates_type StaticShape<Extents...>::getCoords(uint64_t itemIndex) const{
+
+        coordinates_type coordinates{};
+
+        // From the last dimension, which is the fastest one
+        [&]<uint64_t... D>(std::integer_sequence<uint64_t, D...>){
+            ((coordinates[rank - 1 - D] = itemIndex % extent<rank - 1 - D>(), itemIndex /= extent<rank - 1 - D>()), ...);
+        }(std::make_integer_sequence<uint64_t, rank>());
+
+        return coordinates;
+    }
+
+    template <uint64_t... Extents>
+    constexpr bool StaticShape<Extents...>::incrementCoords(coordinates_type& coordinates) const{
+
+        for(uint64_t d = rank; d-- > 0;){
+            if(++coordinates[d] < extents_[d]) return false;
+            coordinates[d] = 0;
+        }
+
+        return true;
+    }
+
+    template <uint64_t... Extents>
+    constexpr bool StaticShape<Extents...>::isValidCoordinates(const coordinates_type& coordinates) const{
+
+        return [&]<uint64_t... D>(std::integer_sequence<uint64_t, D...>){
+            return ((coordinates[D] < extent<D>()) && ...);
+        }(std::make_integer_sequence<uint64_t, rank>());
+    }
+
+
+
+    // STATIC TENSOR: ---------------------------------------------------------------------------------------------------------
+
+    template <class T, static_shape Shape, MemoryBackendConcept<T> DataMB>
+    StaticTensor<T, Shape, DataMB>::StaticTensor(const Shape& shape)
+    : shape_(shape), tensor_(shape.getNumberOfItems()){
+
+    }
+
+    template <class T, static_shape Shape, MemoryBackendConcept<T> DataMB>
+    StaticTensor<T, Shape, DataMB>::StaticTensor(const Shape& shape, const LinearContainer<T>& newData)
+    : shape_(shape), tensor_(shape.getNumberOfItems()){
+
+        std::copy_n(newData.data(), std::min<uint64_t>(newData.size(), tensor_.size()), tensor_.data());
+    }
+
+    template <class T, static_shape Shape, MemoryBackendConcept<T> DataMB>
+    StaticTensor<T, Shape, DataMB>::StaticTensor(const Tensor<T>& tensor)
+    : StaticTensor(Shape::fromDimensionSizes(span_view<uint64_t>(tensor.getDimensionSizes()))){
+
+        std::copy_n(tensor.getData(), tensor_.size(), tensor_.data());
+    }
+
+    template <class T, static_shape Shape, MemoryBackendConcept<T> DataMB>
+    Tensor<T> StaticTensor<T, Shape, DataMB>::toTensor() const{
+
+        LinearContainer<uint64_t> dimensionSizes(Shape::rank);
+        std::copy_n(shape_.getDimensionSizes().data(), Shape::rank, dimensionSizes.data());
+
+        LinearContainer<T> items(tensor_.size());
+        std::copy_n(tensor_.data(), tensor_.size(), items.data());
+
+        return Tensor<T>(dimensionSizes, items);
+    }
+
+    template <class T, static_shape Shape, MemoryBackendConcept<T> DataMB>
+    const Shape& StaticTensor<T, Shape, DataMB>::getShape() const{
+        return shape_;
+    }
+
+    template <class T, static_shape Shape, MemoryBackendConcept<T> DataMB>
+    const typename StaticTensor<T, Shape, DataMB>::coordinates_type& StaticTensor<T, Shape, DataMB>::getDimensionSizes() const{
+        return shape_.getDimensionSizes();
+    }
+
+    template <class T, static_shape Shape, MemoryBackendConcept<T> DataMB>
+    constexpr /*static*/ uint64_t StaticTensor<T, Shape, DataMB>::getNumberOfDimensions(){
+        return Shape::rank;
+    }
+
+    template <class T, static_shape Shape, MemoryBackendConcept<T> DataMB>
+    uint64_t StaticTensor<T, Shape, DataMB>::getNumberOfItems() const{
+        return tensor_.size();
+    }
+
+    template <class T, static_shape Shape, MemoryBackendConcept<T> DataMB>
+    T& StaticTensor<T, Shape, DataMB>::getItem(const coordinates_type& coordinates){
+        return tensor_[shape_.getIndex(coordinates)];
+    }
+
+    template <class T, static_shape Shape, MemoryBackendConcept<T> DataMB>
+    const T& StaticTensor<T, Shape, DataMB>::getItem(const coordinates_type& coordinates) const{
+        return tensor_[shape_.getIndex(coordinates)];
+    }
+
+    template <class T, static_shape Shape, MemoryBackendConcept<T> DataMB>
+    void StaticTensor<T, Shape, DataMB>::setItem(const T& value, const coordinates_type& coordinates){
+        tensor_[shape_.getIndex(coordinates)] = value;
+    }
+
+    template <class T, static_shape Shape, MemoryBackendConcept<T> DataMB>
+    template <std::convertible_to<uint64_t>... I>
+    T& StaticTensor<T, Shape, DataMB>::operator()(const I... coordinates) requires (sizeof...(I) == Shape::rank){
+        return tensor_[shape_.getIndex(coordinates_type{static_cast<uint64_t>(coordinates)...})];
+    }
+
+    template <class T, static_shape Shape, MemoryBackendConcept<T> DataMB>
+    template <std::convertible_to<uint64_t>... I>
+    const T& StaticTensor<T, Shape, DataMB>::operator()(const I... coordinates) const requires (sizeof...(I) == Shape::rank){
+        return tensor_[shape_.getIndex(coordinates_type{static_cast<uint64_t>(coordinates)...})];
+    }
+
+    template <class T, static_shape Shape, MemoryBackendConcept<T> DataMB>
+    T* StaticTensor<T, Shape, DataMB>::getData(){
+        return tensor_.data();
+    }
+
+    template <class T, static_shape Shape, MemoryBackendConcept<T> DataMB>
+    const T* StaticTensor<T, Shape, DataMB>::getData() const{
+        return tensor_.data();
+    }
+
+    template <class T, static_shape Shape, MemoryBackendConcept<T> DataMB>
+    void StaticTensor<T, Shape, DataMB>::fillWith(const T& fill){
+        tensor_.fill(fill);
+    }
+
+    template <class T, static_shape Shape, MemoryBackendConcept<T> DataMB>
+    std::string StaticTensor<T, Shape, DataMB>::toString() const{
+        return toTensor().toString();
+    }
+
+    template <class T, static_shape Shape, MemoryBackendConcept<T> DataMB>
+    bool StaticTensor<T, Shape, DataMB>::operator==(const StaticTensor& otherTensor) const{
+        return shape_ == otherTensor.shape_ && tensor_ == otherTensor.tensor_;
+    }
+}
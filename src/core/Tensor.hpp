@@ -109,10 +109,22 @@ class Tensor : public AbstractOperation<Tensor<T, DataMB, MetadataMB>> {
     template<typename U, typename DMB, typename MDMB>
     using type = Tensor<U, DMB, MDMB>;
 
+    /// Type of tensor holding results of operations on this tensor, used by evaluation of expressions.
+    template<typename U>
+    using rebind = Tensor<U>;
+
     using value_type = T;
+    using memory_backend = DataMB;
+
+    /// Number of dimensions up to which dimension sizes and jumps are stored inside of the tensor without allocation.
+    constexpr static size_t metadataInlineRank = 8;
 
     using DataContainer = LinearContainer<T, DataMB>;
-    using MetadataContainer = LinearContainer<uint64_t, MetadataMB>;
+    using MetadataContainer = LinearContainer<uint64_t, MetadataMB, metadataInlineRank>;
+
+    // Parallel tensor changes dimension sizes of its inner tensor while items are moved by kernels
+    template <class U>
+    friend class TensorParallel;
 
     protected:
 
@@ -149,11 +161,11 @@ class Tensor : public AbstractOperation<Tensor<T, DataMB, MetadataMB>> {
      *
      * @param newDimensionSizes Vector filled with sizes of dimensions.
     */
-    Tensor(const LinearContainer<uint64_t, MetadataMB>& newDimensionSizes);
+    Tensor(const MetadataContainer& newDimensionSizes);
 
     //Tensor(span_view<uint64_t> newDimensionSizes);
 
-    Tensor(const LinearContainer<uint64_t, MetadataMB>& newDimensionSizes, const DataMB& memoryBackend);
+    Tensor(const MetadataContainer& newDimensionSizes, const DataMB& memoryBackend);
 
     Tensor(const DataMB& memoryBackend, const MetadataMB& metadataBackend);
 
@@ -165,7 +177,7 @@ class Tensor : public AbstractOperation<Tensor<T, DataMB, MetadataMB>> {
      * @param newDimensionSizes Vector filled with sizes of dimensions.
      * @param newData one dimensional vector of items to be added by order.
      */
-    Tensor(const LinearContainer<uint64_t, MetadataMB>& newDimensionSizes, const LinearContainer<T, DataMB>& newData);
+    Tensor(const MetadataContainer& newDimensionSizes, const LinearContainer<T, DataMB>& newData);
     
     //Tensor(span_view<uint64_t> newDimensionSizes, const DataMB& dataBackend, const MetadataMB& metadataBackend);
 
@@ -192,6 +204,17 @@ class Tensor : public AbstractOperation<Tensor<T, DataMB, MetadataMB>> {
     template <typename OtherTensor>
     Tensor(const OtherTensor* otherTensor);
 
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Evaluates lazy expression created by operator overloads (like `a * b + c`) into this new tensor. All items are
+     * computed in one loop, without any temporary tensors. Dimension sizes are taken from the first tensor in the expression.
+     * Implicit, so expression can be directly assigned to tensor declaration. Throws std::invalid_argument if other tensor
+     * operands have different dimension sizes.
+     * 
+     * @param expression expression to be evaluated.
+     */
+    template <tensor_expression E>
+    Tensor(const E& expression);
+
     /** -----------------------------------------------------------------------------------------------------------------------
      * @brief Empty constructor so it can be declared without being initalized - trying to do something with
      * uninitialized tensor is sure undefined behavior, not recommended.
@@ -205,7 +228,7 @@ class Tensor : public AbstractOperation<Tensor<T, DataMB, MetadataMB>> {
      * 
      * @return Vector containing one int per dimension with value of its size.
     */
-    const LinearContainer<uint64_t, MetadataMB>& getDimensionSizes() const;
+    const MetadataContainer& getDimensionSizes() const;
 
     /** -----------------------------------------------------------------------------------------------------------------------
      * @brief Gets the number of dimensions of a tensor.
@@ -336,6 +359,14 @@ class Tensor : public AbstractOperation<Tensor<T, DataMB, MetadataMB>> {
     void copyOver(const Tensor<T>& otherTensor, std::span<const uint64_t> thisFromCoordsInclusive, 
     std::span<const uint64_t> thisToCoordsExclusive, std::span<const uint64_t> sourceFromCoordsInclusive);
 
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Makes view of the whole tensor, that can be sliced, permuted, broadcasted and squeezed without copying items.
+     * 
+     * @return View referring to data of this tensor, valid until the data is reallocated.
+     */
+    TensorView<T, DataMB, MetadataMB> view();
+    TensorView<const T, DataMB, MetadataMB> view() const;
+
     /** -----------------------------------------------------------------------------------------------------------------------
      * @brief Swaps two dimensions in a tensor.
      * 
@@ -397,6 +428,30 @@ class Tensor : public AbstractOperation<Tensor<T, DataMB, MetadataMB>> {
     template <binary_operation_on_items<T> I>
     void collapseDimension(const uint64_t dimensionIndex, const I& binaryOperation);
 
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Reduces all items into single value using given binary operation, the result is combined with init. Operation
+     * must be associative, items are accumulated in several independent lanes and large tensors are split between threads,
+     * so grouping of the operations is unspecified, but items are always combined in their index order.
+     * 
+     * @param operation binary operation returning T, for example std::plus<T>().
+     * @param init value combined with result of the reduction, usually identity of the operation.
+     * 
+     * @return Result of the reduction, or init if the tensor has no items.
+     */
+    template <reduce_callable<T> C>
+    T reduce(C&& operation, const T& init) const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Reduces items along specified dimension using given binary operation and deletes that dimension. Every resulting
+     * item is init combined with all items of the reduced dimension sharing the rest of coordinates.
+     * 
+     * @param dimensionIndex index of dimension to reduce.
+     * @param operation binary operation returning T, must be associative.
+     * @param init value combined with result of the reduction, usually identity of the operation.
+     */
+    template <reduce_callable<T> C>
+    void reduce(const uint64_t dimensionIndex, C&& operation, const T& init);
+
 
     
     // OPERATOR OVERLOADS -----------------------------------------------------------------------------------------------------
@@ -419,6 +474,18 @@ class Tensor : public AbstractOperation<Tensor<T, DataMB, MetadataMB>> {
      */
     Tensor<T, DataMB, MetadataMB>& operator=(Tensor<T, DataMB, MetadataMB>&& otherTensor) noexcept;
 
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Evaluates lazy expression into this tensor in one loop. Expression may refer to this tensor itself, items are
+     * only read at the same index they are written to. If the shape of expression differs, this tensor takes it. Throws
+     * std::invalid_argument if tensor operands have different dimension sizes.
+     * 
+     * @param expression expression to be evaluated.
+     * 
+     * @return Reference to this tensor after the evaluation.
+     */
+    template <tensor_expression E>
+    Tensor<T, DataMB, MetadataMB>& operator=(const E& expression);
+
     /** -----------------------------------------------------------------------------------------------------------------------
      * @brief Compares two tensors, checks if all items are equal and if the dimension sizes are equal.
      * 
@@ -1058,11 +1125,12 @@ class Tensor : public AbstractOperation<Tensor<T, DataMB, MetadataMB>> {
      * 
      * @param tensor2 a second tensor to use the operation against as second operand.
      * @param operation a binary function that defines operation between two items.
+     * @param policy ExecutionPolicy::parallel splits items between threads, operation must be safe to call concurrently.
      * 
      * @return A pointer to new resulting tensor.
      */
     template <apply_and_return_callable<T> C>
-    auto applyAndReturn(const Tensor<T>& tensor2, C&& operation) const;
+    auto applyAndReturn(const Tensor<T>& tensor2, C&& operation, const ExecutionPolicy policy = ExecutionPolicy::sequential) const;
     
     /** -----------------------------------------------------------------------------------------------------------------------
      * @brief Allows to apply custom operation two arguments where either one of them is tensor and one of them is value
@@ -1073,11 +1141,13 @@ class Tensor : public AbstractOperation<Tensor<T, DataMB, MetadataMB>> {
      * @param operand1 first operand either tensor or value of type T.
      * @param operand2 second operand either tensor or value of type T.
      * @param operation binary operation returning T and having correct signature defined in concept.
+     * @param policy ExecutionPolicy::parallel splits items between threads, operation must be safe to call concurrently.
      * 
      * @return A pointer to new resulting tensor.
      */
     template <typename A, typename B, apply_and_return_callable<T> C> 
-    static auto applyAndReturn(const A& operand1, const B& operand2, C&& operation)
+    static auto applyAndReturn(const A& operand1, const B& operand2, C&& operation,
+    const ExecutionPolicy policy = ExecutionPolicy::sequential)
     requires(tensor_or_t_or_bothtensor<A, B, T>);
 
     /** -----------------------------------------------------------------------------------------------------------------------
@@ -1085,9 +1155,21 @@ class Tensor : public AbstractOperation<Tensor<T, DataMB, MetadataMB>> {
      * 
      * @param tensor2 a second tensor to use the operation against as second operand.
      * @param operation a binary function that defines operation between two items.
+     * @param policy ExecutionPolicy::parallel splits items between threads, operation must be safe to call concurrently.
      */
     template <apply_callable<T> C>
-    void apply(const Tensor<T>& tensor2, C&& operation);
+    void apply(const Tensor<T>& tensor2, C&& operation, const ExecutionPolicy policy = ExecutionPolicy::sequential);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Evaluates lazy expression and applies custom operation between each item of this tensor and the evaluated item,
+     * storing the result into caller tensor. The expression is never stored in temporary tensor.
+     * 
+     * @param expression expression to use as second operand, should have the same item count as this tensor.
+     * @param operation a binary function that defines operation between two items.
+     * @param policy ExecutionPolicy::parallel splits items between threads, operation must be safe to call concurrently.
+     */
+    template <tensor_expression E, typename C>
+    void apply(const E& expression, C&& operation, const ExecutionPolicy policy = ExecutionPolicy::sequential);
 
     // /** -----------------------------------------------------------------------------------------------------------------------
     //  * @brief Allows to apply custom operation two arguments where either one of them is tensor and one of them is value
@@ -1101,13 +1183,16 @@ class Tensor : public AbstractOperation<Tensor<T, DataMB, MetadataMB>> {
     //  * @param operation binary operation returning T and having correct signature defined in concept.
     //  */
     template <apply_callable<T> C>
-    static void apply(Tensor<T>& operand1, const Tensor<T>& operand2, C&& operation);
+    static void apply(Tensor<T>& operand1, const Tensor<T>& operand2, C&& operation,
+    const ExecutionPolicy policy = ExecutionPolicy::sequential);
 
     template <apply_callable<T> C>
-    static void apply(Tensor<T>& operand1, const T& operand2, C&& operation);
+    static void apply(Tensor<T>& operand1, const T& operand2, C&& operation,
+    const ExecutionPolicy policy = ExecutionPolicy::sequential);
 
     template <apply_reverse_callable<T> C>
-    static void apply(const T& operand1, Tensor<T>& operand2, C&& operation);
+    static void apply(const T& operand1, Tensor<T>& operand2, C&& operation,
+    const ExecutionPolicy policy = ExecutionPolicy::sequential);
 
     // template <typename A, typename B, apply_callable<T> C> 
     // static void apply(A& operand1, B& operand2, C&& operation)
@@ -1118,11 +1203,12 @@ class Tensor : public AbstractOperation<Tensor<T, DataMB, MetadataMB>> {
      * items into new instance, then returns the new instance. Looping order is unspecified.
      * 
      * @param operation unary operation returning T and having correct signature defined in concept.
+     * @param policy ExecutionPolicy::parallel splits items between threads, operation must be safe to call concurrently.
      * 
      * @return A pointer to new resulting tensor.
      */
     template <foreach_and_return_callable<T> C>
-    auto forEachAndReturn(C&& operation) const;
+    auto forEachAndReturn(C&& operation, const ExecutionPolicy policy = ExecutionPolicy::sequential) const;
 
     /** -----------------------------------------------------------------------------------------------------------------------
      * @brief Creates new instance with same dimensions as given tensor and applies passed callable on all items, then writes 
@@ -1130,28 +1216,69 @@ class Tensor : public AbstractOperation<Tensor<T, DataMB, MetadataMB>> {
      * 
      * @param tensor tensor to perform the operation on.
      * @param operation unary operation returning T and having correct signature defined in concept.
+     * @param policy ExecutionPolicy::parallel splits items between threads, operation must be safe to call concurrently.
      * 
      * @return A pointer to new resulting tensor.
      */
     template <foreach_and_return_callable<T> C>
-    static auto forEachAndReturn(const Tensor<T>& tensor, C&& operation);
+    static auto forEachAndReturn(const Tensor<T>& tensor, C&& operation, const ExecutionPolicy policy = ExecutionPolicy::sequential);
 
     /** -----------------------------------------------------------------------------------------------------------------------
      * @brief Applies operation on all items with passed callable. Looping order is unspecified.
      * 
      * @param operation unary operation, having correct signature defined in concept.
+     * @param policy ExecutionPolicy::parallel splits items between threads, operation must be safe to call concurrently.
      */
     template <foreach_callable<T> C> 
-    void forEach(C&& operation);
+    void forEach(C&& operation, const ExecutionPolicy policy = ExecutionPolicy::sequential);
 
     /** -----------------------------------------------------------------------------------------------------------------------
      * @brief Applies operation on all items in given tensor with passed callable. Looping order is unspecified.
      * 
      * @param tensor to perform the operation on.
      * @param operation unary operation, having correct signature defined in concept.
+     * @param policy ExecutionPolicy::parallel splits items between threads, operation must be safe to call concurrently.
      */
     template <foreach_callable<T> C>
-    static void forEach(Tensor<T>& tensor, C&& operation);
+    static void forEach(Tensor<T>& tensor, C&& operation, const ExecutionPolicy policy = ExecutionPolicy::sequential);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Applies operation on all items together with their coordinates. Coordinates are kept in one container per thread
+     * and moved to the next item by carrying increments, so no item costs an allocation or divisions. Within one thread items
+     * are visited in ascending order.
+     *
+     * @param operation callable as operation(T& item, span_view<uint64_t> coordinates), coordinates are valid only during
+     * the call. Tensor without dimensions calls it once with empty coordinates.
+     * @param policy ExecutionPolicy::parallel splits items between threads, operation must be safe to call concurrently.
+     */
+    template <foreach_coord_callable<T> C>
+    void forEachWithCoords(C&& operation, const ExecutionPolicy policy = ExecutionPolicy::sequential);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Applies operation with coordinates only on items inside the box [boxBegin, boxEnd), see the other overload.
+     *
+     * @param operation callable as operation(T& item, span_view<uint64_t> coordinates), coordinates are of the whole tensor,
+     * not relative to the box.
+     * @param boxBegin inclusive coordinates of the first corner of the box.
+     * @param boxEnd exclusive coordinates of the opposite corner of the box.
+     * @param policy ExecutionPolicy::parallel splits items between threads, operation must be safe to call concurrently.
+     *
+     * @return Bool @b false if the box does not fit into this tensor and nothing was done, otherwise @b true.
+     */
+    template <foreach_coord_callable<T> C>
+    bool forEachWithCoords(C&& operation, span_view<uint64_t> boxBegin, span_view<uint64_t> boxEnd,
+    const ExecutionPolicy policy = ExecutionPolicy::sequential);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Checks if given box [boxBegin, boxEnd) fits into tensor of given dimension sizes. Empty box is valid.
+     *
+     * @param boxBegin inclusive coordinates of the first corner of the box.
+     * @param boxEnd exclusive coordinates of the opposite corner of the box.
+     * @param dimensionSizes dimension sizes of the tensor.
+     *
+     * @return Bool @b true if the box is valid, @b false otherwise.
+     */
+    static bool isValidBox(span_view<uint64_t> boxBegin, span_view<uint64_t> boxEnd, span_view<uint64_t> dimensionSizes);
 
     /** -----------------------------------------------------------------------------------------------------------------------
      * @brief Takes given coordinates as reference and changes it to next coordinates in ascending order. If given coordinates
@@ -1268,10 +1395,68 @@ class Tensor : public AbstractOperation<Tensor<T, DataMB, MetadataMB>> {
      * @warning Do not use outside of constructor!
      */
     void defaultFunctions();
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Reduces contiguous range of items without init, accumulating contiguous parts in independent lanes that are
+     * combined in order at the end, so the loop has no dependency chain between neighboring items and can be vectorized.
+     * 
+     * @param data pointer to the first item.
+     * @param itemCount number of items in range, must be at least one.
+     * @param operation associative binary operation.
+     * 
+     * @return Result of the reduction.
+     */
+    template <reduce_callable<T> C>
+    static T reduceRange(const T* data, const uint64_t itemCount, const C& operation);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Writes items of source into destination with dimensions dim1 and dim2 swapped. Both swapped dimensions are walked
+     * in square tiles, so reads and writes stay within few cache lines, and tiles are split between threads for large tensors.
+     * Items are moved when source is not const.
+     * 
+     * @param source pointer to the first item of the original data.
+     * @param destination pointer to the first item of the transposed data, must not overlap source.
+     * @param dimensionSizes dimension sizes of the original data.
+     * @param dim1 first dimension to swap.
+     * @param dim2 second dimension to swap, different from dim1.
+     */
+    template <typename S>
+    static void transposeItems(S* source, T* destination, const MetadataContainer& dimensionSizes, 
+    uint64_t dim1, uint64_t dim2);
+
+    /// Size of cache line in bytes, that threads of elementwise operations never share.
+    constexpr static uint64_t cacheLineSize_ = 64;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Splits range of item indices into contiguous chunks and calls function on every chunk, each one in its own thread
+     * if policy is parallel and there are enough items. Chunks start on multiples of cache line (or alignment of memory backend
+     * if bigger) of the written items, so two threads never write into the same cache line.
+     * 
+     * @tparam W type of items written by the function.
+     * @param itemCount number of items of the range.
+     * @param policy ExecutionPolicy::sequential calls function once on the whole range.
+     * @param function void(uint64_t begin, uint64_t end) callable processing items [begin, end).
+     */
+    template <typename W, typename F>
+    static void forEachChunk(const uint64_t itemCount, const ExecutionPolicy policy, F&& function);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Evaluates items [begin, end) of expression into data. If the whole expression can be evaluated in SIMD packs
+     * (arithmetic items and operators that exist for packs), packs are stored to aligned addresses and only items before the
+     * first aligned address and after the last whole pack are evaluated one by one.
+     * 
+     * @param expression evaluated expression with items of type T.
+     * @param data destination of the items.
+     * @param begin index of the first evaluated item.
+     * @param end index after the last evaluated item.
+     */
+    template <tensor_expression E>
+    static void evaluateExpression(const E& expression, T* data, const uint64_t begin, const uint64_t end);
 }; // end Tensor
 
 } // end gema
 
 #include "Tensor.tpp"
+#include "TensorView.hpp"
 
 #endif
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <cmath>
 #include <compare>
@@ -8,6 +9,10 @@
 #include <iostream>
 #include <memory>
 #include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "MemoryBackendConcept.hpp"
@@ -202,7 +207,7 @@ namespace gema {
     // PUBLIC METHODS: --------------------------------------------------------------------------------------------------------
 
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
-    Tensor<T, DataMB, MetadataMB>::Tensor(const LinearContainer<uint64_t, MetadataMB>& newDimensionSizes) 
+    Tensor<T, DataMB, MetadataMB>::Tensor(const MetadataContainer& newDimensionSizes) 
     : dimensionSizes_(newDimensionSizes){
         update();
     }
@@ -214,8 +219,7 @@ namespace gema {
     // }
 
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
-    Tensor<T, DataMB, MetadataMB>::Tensor(const LinearContainer<uint64_t, MetadataMB>& newDimensionSizes,
-    const DataMB& memoryBackend)
+    Tensor<T, DataMB, MetadataMB>::Tensor(const MetadataContainer& newDimensionSizes, const DataMB& memoryBackend)
     : tensor_(memoryBackend), dimensionSizes_(newDimensionSizes), dimensionJumps_(newDimensionSizes.getMemoryBackend()){ 
         update();
     }
@@ -228,7 +232,7 @@ namespace gema {
 
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
     inline Tensor<T, DataMB, MetadataMB>::Tensor
-    (const LinearContainer<uint64_t, MetadataMB>& newDimensionSizes, const LinearContainer<T, DataMB>& newData) 
+    (const MetadataContainer& newDimensionSizes, const LinearContainer<T, DataMB>& newData) 
     : dimensionSizes_(newDimensionSizes), tensor_(newData), dimensionJumps_(newDimensionSizes.getMemoryBackend()){
 
         // Check actual capacity of dimensions to tensorData
@@ -277,13 +281,31 @@ namespace gema {
         dimensionJumps_ = otherTensor->dimensionJumps_;
     }
 
+    template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    template <tensor_expression E>
+    Tensor<T, DataMB, MetadataMB>::Tensor(const E& expression)
+    : dimensionSizes_(expression.getDimensionSizes()){
+
+        if(!expression.hasMatchingOperands()){
+            throw std::invalid_argument("Operands of tensor expression have different dimension sizes");
+        }
+
+        update();
+
+        // Expressions are built only by operators, whose operations have no state, so they are always safe to split
+        T* data = tensor_.data();
+        forEachChunk<T>(tensor_.size(), ExecutionPolicy::parallel, [data, &expression](const uint64_t begin, const uint64_t end){
+            evaluateExpression(expression, data, begin, end);
+        });
+    }
+
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
     Tensor<T, DataMB, MetadataMB>::Tensor(){
 
     }
 
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
-    const LinearContainer<uint64_t, MetadataMB>& Tensor<T, DataMB, MetadataMB>::getDimensionSizes() const{
+    const typename Tensor<T, DataMB, MetadataMB>::MetadataContainer& Tensor<T, DataMB, MetadataMB>::getDimensionSizes() const{
         return dimensionSizes_;
     }
 
@@ -444,14 +466,24 @@ namespace gema {
         tensor_.fill(value);
     }
 
+    template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    TensorView<T, DataMB, MetadataMB> Tensor<T, DataMB, MetadataMB>::view(){
+        return TensorView<T, DataMB, MetadataMB>(*this);
+    }
+
+    template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    TensorView<const T, DataMB, MetadataMB> Tensor<T, DataMB, MetadataMB>::view() const {
+        return TensorView<const T, DataMB, MetadataMB>(*this);
+    }
+
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
     Tensor<T, DataMB, MetadataMB> Tensor<T, DataMB, MetadataMB>::transpositionAndReturn(const uint64_t dim1, const uint64_t dim2) const {
 
-        if(dim1 == dim2) return Tensor<T, DataMB, MetadataMB>(dimensionSizes_);
+        if(dim1 == dim2) return *this;
 
         // Copying the dimensionSizes
         // Change assigment to just construction of correct size
-        LinearContainer<uint64_t, MetadataMB> transposedDimensionSizes = dimensionSizes_; 
+        MetadataContainer transposedDimensionSizes = dimensionSizes_; 
 
         // Swapping the dimension sizes
         transposedDimensionSizes[dim1] = dimensionSizes_[dim2]; 
@@ -461,25 +493,7 @@ namespace gema {
         Tensor<T, DataMB, MetadataMB> tensorTransposed = 
             Tensor<T, DataMB, MetadataMB>(transposedDimensionSizes, tensor_.getMemoryBackend());
 
-        LinearContainer<uint64_t> original, switched;
-        original.resize(dimensionSizes_.size());
-        switched.resize(dimensionSizes_.size());
-        original.fill(0);
-
-        // Looping through elements in tensor and swapping the desired coordinates
-        for(uint64_t i = 0; i < tensor_.size(); ++i){
-            
-            // The swap of two desired coordinates
-            switched = original;
-            switched[dim1] = original[dim2];
-            switched[dim2] = original[dim1];
-
-            // Works until now, check the getIndex function if it actually works properly
-            tensorTransposed.tensor_[tensorTransposed.getIndex(switched)] = std::move(tensor_[i]);
-
-            //std::cout << original[0] << " " << original[1] << std::endl;
-            Tensor<T, DataMB, MetadataMB>::incrementCoords(original, dimensionSizes_);
-        }
+        transposeItems(tensor_.data(), tensorTransposed.tensor_.data(), dimensionSizes_, dim1, dim2);
 
         return tensorTransposed;
     }
@@ -491,7 +505,7 @@ namespace gema {
 
         // Copying the dimensionSizes
         // Change assigment to just construction of correct size
-        const LinearContainer<uint64_t> oldDimensionSizes = dimensionSizes_.copyToBackend(MemoryBackend<uint64_t>());
+        const MetadataContainer oldDimensionSizes = dimensionSizes_;
 
         // Swapping the dimension sizes
         const uint64_t temporaryDimensionSize1 = dimensionSizes_[dim1];
@@ -503,26 +517,7 @@ namespace gema {
         // Initializing the new data
         LinearContainer<T, DataMB> newTensorData(itemCount, tensor_.getMemoryBackend());
 
-        LinearContainer<uint64_t> original, switched;
-        original.resize(dimensionSizes_.size());
-        switched.resize(dimensionSizes_.size());
-        original.fill(0);
-
-        // Looping through elements in tensor and swapping the desired coordinates
-        for(uint64_t i = 0; i < itemCount; ++i){
-            
-            //if (original[dim1] == original[dim2]) [[unlikely]] continue;
-
-            // The swap of two desired coordinates
-            switched = original;
-            switched[dim1] = original[dim2];
-            switched[dim2] = original[dim1];
-
-            // Works until now, check the getIndex function if it actually works properly
-            newTensorData[getIndex(switched)] = std::move(tensor_[i]);
-
-            Tensor<T, DataMB, MetadataMB>::incrementCoords(original, oldDimensionSizes);
-        }
+        transposeItems(tensor_.data(), newTensorData.data(), oldDimensionSizes, dim1, dim2);
 
         tensor_ = std::move(newTensorData);
     }
@@ -619,8 +614,8 @@ namespace gema {
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
     void Tensor<T, DataMB, MetadataMB>::addDimension(const uint64_t newDimensionSize, const uint64_t putBefore){
 
-        const LinearContainer<uint64_t, MetadataMB> oldDimensionSizes = dimensionSizes_; //todo: probably delete
-        const LinearContainer<uint64_t, MetadataMB> oldDimensionJumps = dimensionJumps_; //todo: probably delete
+        const MetadataContainer oldDimensionSizes = dimensionSizes_; //todo: probably delete
+        const MetadataContainer oldDimensionJumps = dimensionJumps_; //todo: probably delete
 
         dimensionSizes_.insert(dimensionSizes_.begin() + putBefore, newDimensionSize);
 
@@ -660,8 +655,8 @@ namespace gema {
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
     void Tensor<T, DataMB, MetadataMB>::removeDimension(const uint64_t removedDimensionIndex){
 
-        const LinearContainer<uint64_t, MetadataMB> oldDimensionSizes = dimensionSizes_;
-        const LinearContainer<uint64_t, MetadataMB> oldDimensionJumps = dimensionJumps_;
+        const MetadataContainer oldDimensionSizes = dimensionSizes_;
+        const MetadataContainer oldDimensionJumps = dimensionJumps_;
 
         dimensionSizes_.erase(dimensionSizes_.begin() + removedDimensionIndex);
 
@@ -700,8 +695,106 @@ namespace gema {
 
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
     template <binary_operation_on_items<T> I>
-    void Tensor<T, DataMB, MetadataMB>::collapseDimension(const uint64_t dimensionIndex, const I &binaryOperation)
-    {
+    void Tensor<T, DataMB, MetadataMB>::collapseDimension(const uint64_t dimensionIndex, const I& binaryOperation){
+
+        // Items are viewed as [outer][collapsed][inner] block, where inner items are contiguous
+        const uint64_t collapsedSize = dimensionSizes_[dimensionIndex];
+        const uint64_t innerCount = dimensionJumps_[dimensionIndex];
+
+        dimensionSizes_.erase(dimensionSizes_.begin() + dimensionIndex);
+
+        const uint64_t newItemCount = updateDimensionJump();
+        const uint64_t outerCount = (innerCount == 0 || collapsedSize == 0) ? 0 : newItemCount / innerCount;
+
+        LinearContainer<T, DataMB> newTensor(newItemCount);
+
+        for(uint64_t o = 0; o < outerCount; ++o){
+
+            T* result = newTensor.data() + o * innerCount;
+            T* source = tensor_.data() + o * collapsedSize * innerCount;
+
+            for(uint64_t k = 0; k < innerCount; ++k){
+                result[k] = std::move(source[k]);
+            }
+
+            // Whole rows are accumulated at once, so both rows are read sequentially
+            for(uint64_t j = 1; j < collapsedSize; ++j){
+
+                const T* row = source + j * innerCount;
+                for(uint64_t k = 0; k < innerCount; ++k){
+                    binaryOperation(result[k], row[k]);
+                }
+            }
+        }
+
+        tensor_ = std::move(newTensor);
+    }
+
+    template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    template <reduce_callable<T> C>
+    T Tensor<T, DataMB, MetadataMB>::reduce(C&& operation, const T& init) const{
+
+        const uint64_t itemCount = tensor_.size();
+        if(itemCount == 0){
+            return init;
+        }
+
+        const T* data = tensor_.data();
+
+        // Threads are worth it only when every one of them gets enough items
+        constexpr uint64_t minItemsPerThread = 1 << 16;
+        const uint64_t threadCount = std::min<uint64_t>(
+            std::max(1u, std::thread::hardware_concurrency()), 
+            itemCount / minItemsPerThread
+        );
+
+        if(threadCount <= 1){
+            return operation(init, reduceRange(data, itemCount, operation));
+        }
+
+        std::vector<std::optional<T>> partialResults(threadCount);
+        {
+            std::vector<std::jthread> threads;
+            threads.reserve(threadCount);
+
+            const uint64_t chunkSize = itemCount / threadCount;
+            for(uint64_t t = 0; t < threadCount; ++t){
+
+                const uint64_t begin = t * chunkSize;
+                const uint64_t count = (t == threadCount - 1) ? (itemCount - begin) : chunkSize;
+
+                threads.emplace_back([&partialResults, &operation, data, t, begin, count](){
+                    partialResults[t] = reduceRange(data + begin, count, operation);
+                });
+            }
+        } // Threads join here
+
+        T result = init;
+        for(const std::optional<T>& partialResult : partialResults){
+            result = operation(result, *partialResult);
+        }
+
+        return result;
+    }
+
+    template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    template <reduce_callable<T> C>
+    void Tensor<T, DataMB, MetadataMB>::reduce(const uint64_t dimensionIndex, C&& operation, const T& init){
+
+        const bool isCollapsedEmpty = dimensionSizes_[dimensionIndex] == 0;
+
+        collapseDimension(dimensionIndex, [&operation](T& accumulated, const T& item){
+            accumulated = operation(accumulated, item);
+        });
+
+        if(isCollapsedEmpty){
+            fillWith(init);
+            return;
+        }
+
+        for(T& item : tensor_){
+            item = operation(init, item);
+        }
     }
 
     // SPECIAL OPERATOR OVERLOADS ---------------------------------------------------------------------------------------------
@@ -738,6 +831,28 @@ namespace gema {
         return *this;
     }
 
+    template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    template <tensor_expression E>
+    Tensor<T, DataMB, MetadataMB>& Tensor<T, DataMB, MetadataMB>::operator=(const E& expression){
+
+        // Items are computed in place only if shape stays the same, reallocation would invalidate data of this tensor if it
+        // is part of the expression
+        if(!std::ranges::equal(span_view<uint64_t>(dimensionSizes_), span_view<uint64_t>(expression.getDimensionSizes()))){
+            return *this = Tensor<T, DataMB, MetadataMB>(expression);
+        }
+
+        if(!expression.hasMatchingOperands()){
+            throw std::invalid_argument("Operands of tensor expression have different dimension sizes");
+        }
+
+        T* data = tensor_.data();
+        forEachChunk<T>(tensor_.size(), ExecutionPolicy::parallel, [data, &expression](const uint64_t begin, const uint64_t end){
+            evaluateExpression(expression, data, begin, end);
+        });
+
+        return *this;
+    }
+
     // Do not simplify
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
     bool Tensor<T, DataMB, MetadataMB>::operator==(const Tensor<T, DataMB, MetadataMB>& otherTensor) const{
@@ -1081,70 +1196,103 @@ namespace gema {
 
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
     template <apply_and_return_callable<T> C>
-    auto Tensor<T, DataMB, MetadataMB>::applyAndReturn(const Tensor<T>& tensor2, C&& operation) const {
+    auto Tensor<T, DataMB, MetadataMB>::applyAndReturn(const Tensor<T>& tensor2, C&& operation, const ExecutionPolicy policy) const {
 
         //std::transform(tensor_.begin(), tensor_.end(), tensor2.tensor_.begin(), resultTensor->tensor_.begin(), operation);
-        return Tensor<T, DataMB, MetadataMB>::applyAndReturn(*this, tensor2, std::forward<C>(operation));
+        return Tensor<T, DataMB, MetadataMB>::applyAndReturn(*this, tensor2, std::forward<C>(operation), policy);
     }
 
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
     template <typename A, typename B, apply_and_return_callable<T> C>
-    /*static*/ auto gema::Tensor<T, DataMB, MetadataMB>::applyAndReturn(const A& operand1, const B& operand2, C&& operation)
+    /*static*/ auto gema::Tensor<T, DataMB, MetadataMB>::applyAndReturn(const A& operand1, const B& operand2, C&& operation,
+    const ExecutionPolicy policy)
     requires(tensor_or_t_or_bothtensor<A, B, T>){
         
-        using opReturnType = decltype(operation(std::declval<T>(), std::declval<T>()));
+        using opReturnType = materialized_t<decltype(operation(std::declval<T>(), std::declval<T>()))>;
         const Tensor<T>* tensorOperand = type_pick<Tensor<T>>(operand1, operand2);
         Tensor<opReturnType> resultTensor = Tensor<opReturnType>(tensorOperand->getDimensionSizes());
 
         opReturnType* resultTensorData = resultTensor.getData();
 
-        //#pragma GCC ivdep
-        for(uint64_t i = 0; i < tensorOperand->tensor_.size(); ++i){
+        forEachChunk<opReturnType>(tensorOperand->tensor_.size(), policy, 
+        [&operand1, &operand2, &operation, resultTensorData](const uint64_t begin, const uint64_t end){
+
+            //#pragma GCC ivdep
+            for(uint64_t i = begin; i < end; ++i){
 
-            if constexpr (std::is_same_v<A, B>){
-                resultTensorData[i] = operation(operand1.tensor_[i], operand2.tensor_[i]);
-            }else if constexpr (std::is_same_v<A, T>){
-                resultTensorData[i] = operation(operand1, operand2.tensor_[i]);
-            }else if constexpr (std::is_same_v<B, T>){
-                resultTensorData[i] = operation(operand1.tensor_[i], operand2);
+                if constexpr (std::is_same_v<A, B>){
+                    resultTensorData[i] = operation(operand1.tensor_[i], operand2.tensor_[i]);
+                }else if constexpr (std::is_same_v<A, T>){
+                    resultTensorData[i] = operation(operand1, operand2.tensor_[i]);
+                }else if constexpr (std::is_same_v<B, T>){
+                    resultTensorData[i] = operation(operand1.tensor_[i], operand2);
+                }
             }
-        }
+        });
 
         return resultTensor;
     }
 
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
     template <apply_callable<T> C>
-    void Tensor<T, DataMB, MetadataMB>::apply(const Tensor<T>& tensor2, C&& operation){
+    void Tensor<T, DataMB, MetadataMB>::apply(const Tensor<T>& tensor2, C&& operation, const ExecutionPolicy policy){
+
+        Tensor<T, DataMB, MetadataMB>::apply(*this, tensor2, std::forward<C>(operation), policy);
+    }
 
-        Tensor<T, DataMB, MetadataMB>::apply(*this, tensor2, std::forward<C>(operation));
+    template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    template <tensor_expression E, typename C>
+    void Tensor<T, DataMB, MetadataMB>::apply(const E& expression, C&& operation, const ExecutionPolicy policy){
+
+        T* data = tensor_.data();
+        forEachChunk<T>(tensor_.size(), policy, [data, &expression, &operation](const uint64_t begin, const uint64_t end){
+            for(uint64_t i = begin; i < end; ++i){
+                operation(data[i], expression.evaluateItem(i));
+            }
+        });
     }
 
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
     template <apply_callable<T> C>
-    /*static*/ void Tensor<T, DataMB, MetadataMB>::apply(Tensor<T>& operand1, const Tensor<T>& operand2, C&& operation){
+    /*static*/ void Tensor<T, DataMB, MetadataMB>::apply(Tensor<T>& operand1, const Tensor<T>& operand2, C&& operation,
+    const ExecutionPolicy policy){
 
-        for(uint64_t i = 0; i < operand1.tensor_.size(); ++i){
-            operation(operand1.tensor_[i], operand2.tensor_[i]);
-        }
+        T* data1 = operand1.tensor_.data();
+        const T* data2 = operand2.tensor_.data();
+
+        forEachChunk<T>(operand1.tensor_.size(), policy, [data1, data2, &operation](const uint64_t begin, const uint64_t end){
+            for(uint64_t i = begin; i < end; ++i){
+                operation(data1[i], data2[i]);
+            }
+        });
     }
 
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
     template <apply_callable<T> C>
-    /*static*/ void Tensor<T, DataMB, MetadataMB>::apply(Tensor<T>& operand1, const T& operand2, C&& operation){
+    /*static*/ void Tensor<T, DataMB, MetadataMB>::apply(Tensor<T>& operand1, const T& operand2, C&& operation,
+    const ExecutionPolicy policy){
         
-        for(uint64_t i = 0; i < operand1.tensor_.size(); ++i){
-            operation(operand1.tensor_[i], operand2);
-        }
+        T* data1 = operand1.tensor_.data();
+
+        forEachChunk<T>(operand1.tensor_.size(), policy, [data1, &operand2, &operation](const uint64_t begin, const uint64_t end){
+            for(uint64_t i = begin; i < end; ++i){
+                operation(data1[i], operand2);
+            }
+        });
     }
 
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
     template <apply_reverse_callable<T> C>
-    /*static*/ void Tensor<T, DataMB, MetadataMB>::apply(const T& operand1, Tensor<T>& operand2, C&& operation){
+    /*static*/ void Tensor<T, DataMB, MetadataMB>::apply(const T& operand1, Tensor<T>& operand2, C&& operation,
+    const ExecutionPolicy policy){
         
-        for(uint64_t i = 0; i < operand2.tensor_.size(); ++i){
-            operation(operand1, operand2.tensor_[i]);
-        }
+        T* data2 = operand2.tensor_.data();
+
+        forEachChunk<T>(operand2.tensor_.size(), policy, [&operand1, data2, &operation](const uint64_t begin, const uint64_t end){
+            for(uint64_t i = begin; i < end; ++i){
+                operation(operand1, data2[i]);
+            }
+        });
     }
 
     // template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
@@ -1170,49 +1318,148 @@ namespace gema {
 
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
     template <foreach_and_return_callable<T> C>
-    auto Tensor<T, DataMB, MetadataMB>::forEachAndReturn(C&& operation) const {
+    auto Tensor<T, DataMB, MetadataMB>::forEachAndReturn(C&& operation, const ExecutionPolicy policy) const {
 
-        return Tensor<T, DataMB, MetadataMB>::forEachAndReturn(*this, std::forward<C>(operation));
+        return Tensor<T, DataMB, MetadataMB>::forEachAndReturn(*this, std::forward<C>(operation), policy);
     }
 
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
     template <foreach_and_return_callable<T> C>
-    /*static*/ auto Tensor<T, DataMB, MetadataMB>::forEachAndReturn(const Tensor<T>& tensor, C&& operation)
+    /*static*/ auto Tensor<T, DataMB, MetadataMB>::forEachAndReturn(const Tensor<T>& tensor, C&& operation, 
+    const ExecutionPolicy policy)
     {
-        using opReturnType = decltype(operation(std::declval<T>()));
+        using opReturnType = materialized_t<decltype(operation(std::declval<T>()))>;
         Tensor<opReturnType> resultTensor = Tensor<opReturnType>(tensor.getDimensionSizes()); 
 
         opReturnType* resultTensorData = resultTensor.getData();
+        const T* data = tensor.tensor_.data();
 
-        //#pragma GCC ivdep
-        for(uint64_t i = 0; i < tensor.tensor_.size(); ++i){
-            resultTensorData[i] = operation(tensor.tensor_[i]);
-        }
+        forEachChunk<opReturnType>(tensor.tensor_.size(), policy, 
+        [data, resultTensorData, &operation](const uint64_t begin, const uint64_t end){
+
+            //#pragma GCC ivdep
+            for(uint64_t i = begin; i < end; ++i){
+                resultTensorData[i] = operation(data[i]);
+            }
+        });
 
         return resultTensor;
     }
 
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
     template <foreach_callable<T> C>
-    void Tensor<T, DataMB, MetadataMB>::forEach(C&& operation){
+    void Tensor<T, DataMB, MetadataMB>::forEach(C&& operation, const ExecutionPolicy policy){
 
-        Tensor<T, DataMB, MetadataMB>::forEach(*this, std::forward<C>(operation));
+        Tensor<T, DataMB, MetadataMB>::forEach(*this, std::forward<C>(operation), policy);
     }
 
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
     template <foreach_callable<T> C>
-    /*static*/ void Tensor<T, DataMB, MetadataMB>::forEach(Tensor<T>& tensor, C&& operation){
+    /*static*/ void Tensor<T, DataMB, MetadataMB>::forEach(Tensor<T>& tensor, C&& operation, const ExecutionPolicy policy){
 
-        //#pragma GCC ivdep
-        for(uint64_t i = 0; i < tensor.tensor_.size(); ++i){
+        T* data = tensor.tensor_.data();
 
-            operation(tensor.tensor_[i]);
-        }
+        forEachChunk<T>(tensor.tensor_.size(), policy, [data, &operation](const uint64_t begin, const uint64_t end){
+
+            //#pragma GCC ivdep
+            for(uint64_t i = begin; i < end; ++i){
+                operation(data[i]);
+            }
+        });
         
         // 2.
         //std::transform(tensor.tensor_.begin(), tensor.tensor_.end(), tensor.tensor_.begin(), apply);
     }
 
+    template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    template <foreach_coord_callable<T> C>
+    void Tensor<T, DataMB, MetadataMB>::forEachWithCoords(C&& operation, const ExecutionPolicy policy){
+
+        LinearContainer<uint64_t> boxBegin(dimensionSizes_.size());
+        std::fill(boxBegin.begin(), boxBegin.end(), 0);
+
+        forEachWithCoords(std::forward<C>(operation), span_view<uint64_t>(boxBegin), span_view<uint64_t>(dimensionSizes_),
+            policy);
+    }
+
+    template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    template <foreach_coord_callable<T> C>
+    bool Tensor<T, DataMB, MetadataMB>::forEachWithCoords(C&& operation, span_view<uint64_t> boxBegin,
+    span_view<uint64_t> boxEnd, const ExecutionPolicy policy){
+
+        if(!isValidBox(boxBegin, boxEnd, dimensionSizes_)) return false;
+
+        const uint64_t dimensionCount = dimensionSizes_.size();
+
+        LinearContainer<uint64_t> boxSizes(dimensionCount);
+        uint64_t boxItemCount = 1;
+        for(uint64_t d = 0; d < dimensionCount; ++d){
+            boxSizes[d] = boxEnd[d] - boxBegin[d];
+            boxItemCount *= boxSizes[d];
+        }
+
+        if(boxItemCount == 0) return true;
+
+        // Tensor without dimensions has its only item at empty coordinates
+        if(dimensionCount == 0){
+            operation(tensor_[0], span_view<uint64_t>());
+            return true;
+        }
+
+        T* data = tensor_.data();
+        const uint64_t* jumps = dimensionJumps_.data();
+
+        forEachChunk<T>(boxItemCount, policy,
+        [&, data, jumps, dimensionCount](const uint64_t begin, const uint64_t end){
+
+            // Only the first item of the chunk is decoded from its index
+            LinearContainer<uint64_t> coordinates(dimensionCount);
+            getCoords(begin, span_view<uint64_t>(boxSizes), coordinates.data());
+
+            uint64_t itemIndex = 0;
+            for(uint64_t d = 0; d < dimensionCount; ++d){
+                coordinates[d] += boxBegin[d];
+                itemIndex += coordinates[d] * jumps[d];
+            }
+
+            const span_view<uint64_t> currentCoordinates(coordinates);
+            const uint64_t lastDimension = dimensionCount - 1;
+
+            for(uint64_t i = begin; i < end; ++i){
+
+                operation(data[itemIndex], currentCoordinates);
+
+                // Odometer, the coordinate that reached end of the box returns to its beginning and carries into the previous
+                uint64_t d = lastDimension;
+                ++coordinates[d];
+                itemIndex += jumps[d];
+
+                while(coordinates[d] == boxEnd[d] && d > 0){
+                    coordinates[d] = boxBegin[d];
+                    itemIndex -= boxSizes[d] * jumps[d];
+                    --d;
+                    ++coordinates[d];
+                    itemIndex += jumps[d];
+                }
+            }
+        });
+
+        return true;
+    }
+
+    template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    /*static*/ bool Tensor<T, DataMB, MetadataMB>::isValidBox(span_view<uint64_t> boxBegin, span_view<uint64_t> boxEnd,
+    span_view<uint64_t> dimensionSizes){
+
+        if(boxBegin.size() != dimensionSizes.size() || boxEnd.size() != dimensionSizes.size()) return false;
+
+        for(uint64_t d = 0; d < dimensionSizes.size(); ++d){
+            if(boxBegin[d] > boxEnd[d] || boxEnd[d] > dimensionSizes[d]) return false;
+        }
+
+        return true;
+    }
+
     
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
     bool Tensor<T, DataMB, MetadataMB>::incrementCoords(std::span<uint64_t> coordinates, std::span<const uint64_t> dimensionSizes){
@@ -1425,6 +1672,247 @@ namespace gema {
         return std::fabs(a - b) < veightedEpsilon;
     }
 
+    template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    template <reduce_callable<T> C>
+    /*static*/ T Tensor<T, DataMB, MetadataMB>::reduceRange(const T* data, const uint64_t itemCount, const C& operation){
+
+        constexpr uint64_t laneCount = 8;
+
+        if(itemCount < 2 * laneCount){
+
+            T result = data[0];
+            for(uint64_t i = 1; i < itemCount; ++i){
+                result = operation(result, data[i]);
+            }
+            return result;
+        }
+
+        // Every lane reduces its own contiguous part, the last one also takes the remainder, so items are combined in order
+        // and the operation does not have to be commutative. Lanes are seeded with first items of their parts, so identity
+        // of the operation is not needed.
+        const uint64_t laneItems = itemCount / laneCount;
+        const T* lastLaneEnd = data + itemCount;
+
+        std::array<T, laneCount> lanes = [data, laneItems]<size_t... I>(std::index_sequence<I...>){
+            return std::array<T, laneCount>{data[I * laneItems]...};
+        }(std::make_index_sequence<laneCount>());
+
+        for(uint64_t i = 1; i < laneItems; ++i){
+            for(uint64_t lane = 0; lane < laneCount; ++lane){
+                lanes[lane] = operation(lanes[lane], data[lane * laneItems + i]);
+            }
+        }
+
+        for(const T* item = data + laneCount * laneItems; item < lastLaneEnd; ++item){
+            lanes[laneCount - 1] = operation(lanes[laneCount - 1], *item);
+        }
+
+        // Neighbouring lanes are combined first, left one as the first operand
+        for(uint64_t width = 1; width < laneCount; width *= 2){
+            for(uint64_t lane = 0; lane + width < laneCount; lane += 2 * width){
+                lanes[lane] = operation(lanes[lane], lanes[lane + width]);
+            }
+        }
+
+        return lanes[0];
+    }
+
+    template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    template <typename S>
+    /*static*/ void Tensor<T, DataMB, MetadataMB>::transposeItems(S* source, T* destination, 
+    const MetadataContainer& dimensionSizes, uint64_t dim1, uint64_t dim2){
+
+        if(dim1 > dim2) std::swap(dim1, dim2);
+
+        // Data is viewed as [outer][rows][middle][columns][inner], where rows and columns are the swapped dimensions, and
+        // transposed as [outer][columns][middle][rows][inner]
+        const auto product = [&dimensionSizes](const uint64_t from, const uint64_t to){
+            return std::accumulate(dimensionSizes.begin() + from, dimensionSizes.begin() + to, uint64_t{1}, 
+                std::multiplies<uint64_t>());
+        };
+
+        const uint64_t outer = product(0, dim1);
+        const uint64_t rows = dimensionSizes[dim1];
+        const uint64_t middle = product(dim1 + 1, dim2);
+        const uint64_t columns = dimensionSizes[dim2];
+        const uint64_t inner = product(dim2 + 1, dimensionSizes.size());
+
+        const uint64_t itemCount = outer * rows * middle * columns * inner;
+        if(itemCount == 0) return;
+
+        const uint64_t outerJump = rows * middle * columns * inner;
+        const uint64_t sourceRowJump = middle * columns * inner;
+        const uint64_t destinationColumnJump = middle * rows * inner;
+
+        // Runs of inner items are contiguous in both layouts, so long runs need no tiling
+        constexpr uint64_t cacheLineSize = 64;
+        const uint64_t tileSide = (inner * sizeof(T) >= cacheLineSize) ? 1 : (inner == 1 ? 32 : 16);
+        const uint64_t rowTileCount = (rows + tileSide - 1) / tileSide;
+
+        // Full 8x8 blocks of scalars are gathered into local array, compilers turn the copy into register shuffles
+        static constexpr uint64_t blockSide = 8;
+        const auto transposeBlock = [=](const uint64_t sourceBase, const uint64_t destinationBase){
+
+            std::array<T, blockSide * blockSide> block;
+            for(uint64_t i = 0; i < blockSide; ++i){
+                for(uint64_t j = 0; j < blockSide; ++j){
+                    block[j * blockSide + i] = std::move(source[sourceBase + i * sourceRowJump + j]);
+                }
+            }
+            for(uint64_t j = 0; j < blockSide; ++j){
+                for(uint64_t i = 0; i < blockSide; ++i){
+                    destination[destinationBase + j * destinationColumnJump + i] = std::move(block[j * blockSide + i]);
+                }
+            }
+        };
+
+        // One unit is one row of tiles of one 2D slice
+        const auto transposeUnits = [=](const uint64_t firstUnit, const uint64_t lastUnit){
+
+            for(uint64_t unit = firstUnit; unit < lastUnit; ++unit){
+
+                const uint64_t slice = unit / rowTileCount;
+                const uint64_t rowBegin = (unit % rowTileCount) * tileSide;
+                const uint64_t rowEnd = std::min(rowBegin + tileSide, rows);
+
+                const uint64_t sliceOffset = (slice / middle) * outerJump;
+                const uint64_t sourceSlice = sliceOffset + (slice % middle) * columns * inner;
+                const uint64_t destinationSlice = sliceOffset + (slice % middle) * rows * inner;
+
+                for(uint64_t columnBegin = 0; columnBegin < columns; columnBegin += tileSide){
+
+                    const uint64_t columnEnd = std::min(columnBegin + tileSide, columns);
+
+                    if constexpr (std::is_arithmetic_v<T>){
+                        if(inner == 1 && rowEnd - rowBegin == tileSide && columnEnd - columnBegin == tileSide){
+                            for(uint64_t i = rowBegin; i < rowEnd; i += blockSide){
+                                for(uint64_t j = columnBegin; j < columnEnd; j += blockSide){
+                                    transposeBlock(sourceSlice + i * sourceRowJump + j, 
+                                        destinationSlice + j * destinationColumnJump + i);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+
+                    for(uint64_t i = rowBegin; i < rowEnd; ++i){
+                        for(uint64_t j = columnBegin; j < columnEnd; ++j){
+
+                            const uint64_t sourceIndex = sourceSlice + i * sourceRowJump + j * inner;
+                            const uint64_t destinationIndex = destinationSlice + j * destinationColumnJump + i * inner;
+
+                            for(uint64_t k = 0; k < inner; ++k){
+                                destination[destinationIndex + k] = std::move(source[sourceIndex + k]);
+                            }
+                        }
+                    }
+                }
+            }
+        };
+
+        const uint64_t unitCount = outer * middle * rowTileCount;
+
+        // Threads are worth it only when every one of them gets enough items
+        constexpr uint64_t minItemsPerThread = 1 << 16;
+        const uint64_t threadCount = std::min<uint64_t>({
+            std::max(1u, std::thread::hardware_concurrency()), 
+            itemCount / minItemsPerThread,
+            unitCount
+        });
+
+        if(threadCount <= 1){
+            transposeUnits(0, unitCount);
+            return;
+        }
+
+        // Threads join when leaving the function
+        std::vector<std::jthread> threads;
+        threads.reserve(threadCount);
+
+        const uint64_t chunkSize = unitCount / threadCount;
+        for(uint64_t t = 0; t < threadCount; ++t){
+
+            const uint64_t begin = t * chunkSize;
+            const uint64_t end = (t == threadCount - 1) ? unitCount : begin + chunkSize;
+
+            threads.emplace_back(transposeUnits, begin, end);
+        }
+    }
+
+    template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    template <typename W, typename F>
+    /*static*/ void Tensor<T, DataMB, MetadataMB>::forEachChunk(const uint64_t itemCount, const ExecutionPolicy policy, 
+    F&& function){
+
+        // Threads are worth it only when every one of them gets enough items
+        constexpr uint64_t minItemsPerThread = 1 << 16;
+        const uint64_t threadCount = (policy == ExecutionPolicy::sequential) ? 1 : std::min<uint64_t>(
+            std::max(1u, std::thread::hardware_concurrency()), 
+            itemCount / minItemsPerThread
+        );
+
+        if(threadCount <= 1){
+            function(uint64_t(0), itemCount);
+            return;
+        }
+
+        // Data start is aligned by the memory backend, so chunks of whole lines begin on cache line boundary
+        constexpr uint64_t lineBytes = std::max<uint64_t>(cacheLineSize_, memory_backend_alignment_v<DataMB>);
+        constexpr uint64_t lineItems = std::max<uint64_t>(1, lineBytes / sizeof(W));
+
+        const uint64_t itemsPerThread = (itemCount + threadCount - 1) / threadCount;
+        const uint64_t chunkSize = (itemsPerThread + lineItems - 1) / lineItems * lineItems;
+
+        // Threads join when leaving the function
+        std::vector<std::jthread> threads;
+        threads.reserve(threadCount);
+
+        for(uint64_t begin = 0; begin < itemCount; begin += chunkSize){
+            threads.emplace_back([&function, begin, end = std::min(itemCount, begin + chunkSize)](){
+                function(begin, end);
+            });
+        }
+    }
+
+    template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    template <tensor_expression E>
+    /*static*/ void Tensor<T, DataMB, MetadataMB>::evaluateExpression(const E& expression, T* data, const uint64_t begin, 
+    const uint64_t end){
+
+        uint64_t i = begin;
+
+#ifdef GEMA_SIMD
+        if constexpr (simd_operand<E> && std::is_same_v<typename E::value_type, T>){
+
+            constexpr uint64_t packSize = simd_pack<T>::size();
+
+            for(; i < end && !isPackAligned(data + i); ++i){
+                data[i] = expression.evaluateItem(i);
+            }
+
+            // Memory backend aligns every tensor, so operands are usually aligned the same way as the destination
+            bool operandsAligned = true;
+            expression.forEachOperandTensor([&operandsAligned, i](const auto& tensor){
+                operandsAligned = operandsAligned && isPackAligned(tensor.getData() + i);
+            });
+
+            if(operandsAligned){
+                for(; i + packSize <= end; i += packSize){
+                    expression.evaluatePack(i, simd_aligned).copy_to(data + i, simd_aligned);
+                }
+            }else{
+                for(; i + packSize <= end; i += packSize){
+                    expression.evaluatePack(i, simd_unaligned).copy_to(data + i, simd_aligned);
+                }
+            }
+        }
+#endif
+
+        for(; i < end; ++i){
+            data[i] = expression.evaluateItem(i);
+        }
+    }
+
     template <class T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
     void Tensor<T, DataMB, MetadataMB>::defaultFunctions(){
 
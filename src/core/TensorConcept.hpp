@@ -17,6 +17,11 @@ template<class T, MemoryBackendConcept<T> DataMB = MemoryBackend<T>,
 MemoryBackendConcept<uint64_t> MetadataMB = MemoryBackend<uint64_t>>
 class Tensor;
 
+// Forward declaration of view, const T makes read only view.
+template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB = MemoryBackend<std::remove_const_t<T>>, 
+MemoryBackendConcept<uint64_t> MetadataMB = MemoryBackend<uint64_t>>
+class TensorView;
+
 
 // Concept that checks if given type is tensor or derivate of it.
 template <typename Type, class T>
@@ -47,15 +52,19 @@ concept apply_and_return_callable = std::is_invocable_v<C, const T&, const T&>;
 template <typename C, class T>
 concept foreach_callable = std::is_invocable_r_v<void, C, T&>;
 
-/// Checks for void(T&, const std::vector<uint64_t>&) invocable signature.
+/// Checks for void(T&, span_view<uint64_t>) invocable signature, the same as of parallel tensors.
 template <typename C, class T>
-concept foreach_coord_callable = std::is_invocable_r_v<void, C, T&, const LinearContainer<uint64_t>&>;
+concept foreach_coord_callable = std::is_invocable_r_v<void, C, T&, span_view<uint64_t>>;
 
 // Checks for T(const T&) invocable signature.
 template <typename C, class T>
 //concept foreach_and_return_callable = std::is_invocable_r_v<T, C, const T&>;
 concept foreach_and_return_callable = std::is_invocable_v<C, const T&>;
 
+/// Checks for T(const T&, const T&) invocable signature of reduction. The operation should be associative and commutative.
+template <typename C, class T>
+concept reduce_callable = std::is_invocable_r_v<T, C, const T&, const T&>;
+
 
 /// Checks for void(T&, const T&) invocable signature and invocable being trivially copyable.
 template <typename C, class T>
@@ -73,7 +82,8 @@ concept apply_and_return_callable_parallel = apply_and_return_callable<C, T> ;//
 template <typename C, class T>
 concept foreach_callable_parallel = foreach_callable<C, T> ;//&& std::is_trivially_copyable_v<C>;
 
-/// Checks for void(T&, const std::vector<uint64_t>&) invocable signature and invocable being trivially copyable.
+/// Checks for void(T&, span_view<uint64_t>) invocable signature and invocable being trivially copyable. Coordinates are
+/// passed as view, because kernel can not create containers.
 template <typename C, class T>
 concept foreach_coord_callable_parallel = foreach_coord_callable<C, T> ;//&& std::is_trivially_copyable_v<C>;
 
@@ -81,6 +91,10 @@ concept foreach_coord_callable_parallel = foreach_coord_callable<C, T> ;//&& std
 template <typename C, class T>
 concept foreach_and_return_callable_parallel = foreach_and_return_callable<C, T> ;//&& std::is_trivially_copyable_v<C>;
 
+/// Checks for T(const T&, const T&) invocable signature of reduction and invocable being trivially copyable.
+template <typename C, class T>
+concept reduce_callable_parallel = reduce_callable<C, T> ;//&& std::is_trivially_copyable_v<C>;
+
 
 template <template <typename> class TensorT, class T>
 concept tensor_computation_interface = requires (TensorT<T> tensor, T t){
@@ -0,0 +1,420 @@
+#ifndef TENSOR_EXPRESSION_HPP
+#define TENSOR_EXPRESSION_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "Simd.hpp"
+#include "Utils.hpp"
+
+namespace gema {
+
+// Forward declarations for the concepts.
+template<typename Derived>
+class AbstractOperation;
+
+template<typename Expression>
+class TensorExpression;
+
+/// Checks if type is lazy tensor expression (node of expression tree built by operator overloads).
+template <typename E>
+concept tensor_expression = std::derived_from<std::remove_cvref_t<E>, TensorExpression<std::remove_cvref_t<E>>>;
+
+/// Checks if type is tensor that uses operator overloads from AbstractOperation (Tensor, TensorParallel...).
+template <typename X>
+concept operation_tensor = std::derived_from<std::remove_cvref_t<X>, AbstractOperation<std::remove_cvref_t<X>>>;
+
+/// Checks if type can be used as tensor-like operand of expression, that is tensor or another expression.
+template <typename X>
+concept expression_operand = tensor_expression<X> || operation_tensor<X>;
+
+// Item type of expression operand, or the type itself if it is a value.
+template <typename X>
+struct expression_value { using type = X; };
+
+template <expression_operand X>
+struct expression_value<X> { using type = typename std::remove_cvref_t<X>::value_type; };
+
+template <typename X>
+using expression_value_t = typename expression_value<X>::type;
+
+// ============================================================================================================================
+/**
+ * @brief Leaf of expression tree, that refers to tensor operand. Tensor is not copied, only its data are read when the
+ * expression is evaluated, so the tensor must outlive the expression.
+ *
+ * @note Holds only pointers, thus it is trivially copyable and can be passed into kernels. Only the data pointer is
+ * accessed on device.
+ *
+ * @tparam TensorT type of referred tensor.
+ */
+template<typename TensorT>
+class TensorReference {
+
+    public:
+
+    using tensor_type = TensorT;
+    using value_type = typename TensorT::value_type;
+
+    private:
+
+    const TensorT* tensor_;
+    const value_type* data_;
+
+    public:
+
+    TensorReference(const TensorT& tensor);
+
+    const value_type& evaluateItem(const uint64_t itemIndex) const;
+
+#ifdef GEMA_SIMD
+    // Loads pack of items starting at given index, flags tell if the address is aligned to the pack size
+    template <typename Flags>
+    auto evaluatePack(const uint64_t itemIndex, Flags flags) const requires simd_item<value_type>;
+#endif
+
+    const TensorT& getOperandTensor() const;
+
+    template <typename F>
+    void forEachOperandTensor(F&& function) const;
+};
+
+// ============================================================================================================================
+/**
+ * @brief Leaf of expression tree, that holds value operand by copy. Evaluates to the same value for every item.
+ *
+ * @tparam V type of the value.
+ */
+template<typename V>
+class ScalarOperand {
+
+    public:
+
+    using value_type = V;
+
+    private:
+
+    V value_;
+
+    public:
+
+    ScalarOperand(const V& value);
+
+    const V& evaluateItem(const uint64_t itemIndex) const;
+
+#ifdef GEMA_SIMD
+    template <typename Flags>
+    auto evaluatePack(const uint64_t itemIndex, Flags flags) const requires simd_item<V>;
+#endif
+
+    template <typename F>
+    void forEachOperandTensor(F&& function) const;
+};
+
+// Checks if expression node or leaf refers to a tensor, that is every operand except for ScalarOperand.
+template <typename X>
+concept has_operand_tensor = requires (const X& x) { x.getOperandTensor(); };
+
+// Wraps tensor into TensorReference and value into ScalarOperand, expressions are returned as they are.
+template <typename X>
+auto make_expression_operand(const X& operand);
+
+// Creates binary expression node from any two operands, at least one of them should be tensor or expression.
+template <typename Operation, typename A, typename B>
+auto make_binary_expression(const A& operand1, const B& operand2, const Operation& operation);
+
+// Creates unary expression node from tensor or expression.
+template <typename Operation, typename A>
+auto make_unary_expression(const A& operand, const Operation& operation);
+
+// If the result of item operation is expression itself (tensor of tensors), it gets evaluated, so no expression outlives
+// the item operation. Other values are just returned.
+template <typename V>
+auto materialize_expression(V&& value);
+
+// Type of the value after materialize_expression, used to deduce item type of results of custom operations.
+template <typename V>
+using materialized_t = decltype(materialize_expression(std::declval<V>()));
+
+// ============================================================================================================================
+/**
+ * @brief Base of all inner expression nodes. Provides shape of the expression (taken from the first tensor operand),
+ * evaluation into new tensor and unary operator overloads, so unary operations can be chained lazily as well.
+ *
+ * @par
+ * Expressions are created by arithmetic, logical and bitwise operator overloads of tensors. Nothing is computed until the
+ * expression is assigned to tensor (or constructs one), then all items are computed in one fused loop (or one kernel) and
+ * no temporary tensors are allocated. Expression holds tensor operands by reference, so it should be assigned in the same
+ * full-expression it was created in, unless all tensor operands are known to outlive it.
+ *
+ * @tparam Expression derived expression node type (CRTP).
+ */
+template<typename Expression>
+class TensorExpression {
+
+    public:
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Gets the number of items of resulting tensor.
+     *
+     * @return Number of items.
+     */
+    uint64_t getNumberOfItems() const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Gets dimension sizes of resulting tensor, which are the dimension sizes of the first tensor operand.
+     *
+     * @return Dimension sizes container of the first tensor operand.
+     */
+    decltype(auto) getDimensionSizes() const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Evaluates the whole expression into new tensor of the same kind as the first tensor operand.
+     *
+     * @return New tensor with results.
+     */
+    auto evaluate() const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Checks if every tensor operand has the dimension sizes of the expression, otherwise items of smaller operands
+     * would be read out of their bounds.
+     *
+     * @return Bool @b true if all tensor operands have the same shape, @b false otherwise.
+     */
+    bool hasMatchingOperands() const;
+
+    #define UNARY_EXPRESSION(OP_SYMBOL)\
+        template<typename E = Expression>\
+        auto operator OP_SYMBOL() const\
+        requires requires (expression_value_t<E> a) {OP_SYMBOL a;}{\
+            return make_unary_expression(self(), [](const auto& item) -> decltype(materialize_expression(OP_SYMBOL item)){\
+                return materialize_expression(OP_SYMBOL item);\
+            });\
+        }
+
+    UNARY_EXPRESSION(~)
+    UNARY_EXPRESSION(!)
+    UNARY_EXPRESSION(+)
+    UNARY_EXPRESSION(-)
+
+    #undef UNARY_EXPRESSION
+
+    protected:
+
+    const Expression& self() const {
+        return static_cast<const Expression&>(*this);
+    }
+};
+
+// ============================================================================================================================
+/**
+ * @brief Expression node applying binary operation on items of two operands.
+ *
+ * @tparam Operation stateless binary callable.
+ * @tparam Operand1 left operand (TensorReference, ScalarOperand or another expression).
+ * @tparam Operand2 right operand (TensorReference, ScalarOperand or another expression).
+ */
+template<typename Operation, typename Operand1, typename Operand2>
+class BinaryExpression : public TensorExpression<BinaryExpression<Operation, Operand1, Operand2>> {
+
+    static_assert(has_operand_tensor<Operand1> || has_operand_tensor<Operand2>);
+
+    Operand1 operand1_;
+    Operand2 operand2_;
+    [[no_unique_address]] Operation operation_;
+
+    public:
+
+    using value_type = std::remove_cvref_t<decltype(std::declval<const Operation&>()(
+        std::declval<const Operand1&>().evaluateItem(0),
+        std::declval<const Operand2&>().evaluateItem(0)
+    ))>;
+
+    using tensor_type = typename std::conditional_t<has_operand_tensor<Operand1>, Operand1, Operand2>::tensor_type;
+
+    BinaryExpression(const Operand1& operand1, const Operand2& operand2, const Operation& operation);
+
+    value_type evaluateItem(const uint64_t itemIndex) const;
+
+#ifdef GEMA_SIMD
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Evaluates pack of consecutive items at once. Available only if both operands can be evaluated in packs and
+     * the operation accepts packs, which is true for arithmetic and bitwise operators of arithmetic item types.
+     *
+     * @param itemIndex index of the first item of the pack.
+     * @param flags simd_aligned if the items of all tensor operands start on address aligned to the pack size, otherwise
+     * simd_unaligned.
+     * @return Pack of results.
+     */
+    template <typename Flags>
+    auto evaluatePack(const uint64_t itemIndex, Flags flags) const requires simd_operation<Operation, Operand1, Operand2>;
+#endif
+
+    const tensor_type& getOperandTensor() const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Calls given function on every tensor the expression reads from, used to track dependencies of asynchronous
+     * evaluation.
+     *
+     * @param function callable accepting const reference to tensor.
+     */
+    template <typename F>
+    void forEachOperandTensor(F&& function) const;
+};
+
+// ============================================================================================================================
+/**
+ * @brief Expression node applying unary operation on items of its operand.
+ *
+ * @tparam Operation stateless unary callable.
+ * @tparam Operand the operand (TensorReference or another expression).
+ */
+template<typename Operation, typename Operand>
+class UnaryExpression : public TensorExpression<UnaryExpression<Operation, Operand>> {
+
+    Operand operand_;
+    [[no_unique_address]] Operation operation_;
+
+    public:
+
+    using value_type = std::remove_cvref_t<decltype(std::declval<const Operation&>()(
+        std::declval<const Operand&>().evaluateItem(0)
+    ))>;
+
+    using tensor_type = typename Operand::tensor_type;
+
+    UnaryExpression(const Operand& operand, const Operation& operation);
+
+    value_type evaluateItem(const uint64_t itemIndex) const;
+
+#ifdef GEMA_SIMD
+    template <typename Flags>
+    auto evaluatePack(const uint64_t itemIndex, Flags flags) const requires simd_operation<Operation, Operand>;
+#endif
+
+    const tensor_type& getOperandTensor() const;
+
+    template <typename F>
+    void forEachOperandTensor(F&& function) const;
+};
+
+/// Is true if every tensor operand of expression node X is of tensor template TensorT, so for example kernels of
+/// TensorParallel never get expressions that read host memory.
+template <template <typename> class TensorT, typename X>
+constexpr bool expression_over_v = false;
+
+template <template <typename> class TensorT, typename U>
+constexpr bool expression_over_v<TensorT, TensorReference<TensorT<U>>> = true;
+
+template <template <typename> class TensorT, typename V>
+constexpr bool expression_over_v<TensorT, ScalarOperand<V>> = true;
+
+template <template <typename> class TensorT, typename Operation, typename Operand1, typename Operand2>
+constexpr bool expression_over_v<TensorT, BinaryExpression<Operation, Operand1, Operand2>> = 
+    expression_over_v<TensorT, Operand1> && expression_over_v<TensorT, Operand2>;
+
+template <template <typename> class TensorT, typename Operation, typename Operand>
+constexpr bool expression_over_v<TensorT, UnaryExpression<Operation, Operand>> = expression_over_v<TensorT, Operand>;
+
+
+
+// EXPRESSION OPERATOR OVERLOADS ------------------------------------------------------------------------------------------
+// Complements overloads from AbstractOperation, where the same notation is used, extended by:
+// E - expression
+//
+// Examples:
+// EoXrE means Expression performing Operation with Tensor or another Expression Resulting in Expression.
+// ToeE means Tensor performing Operation with Expression in place, evaluated in one fused loop.
+
+#define EXPRESSION_BINARY_EoXrE(OP_SYMBOL)\
+    template<expression_operand A, expression_operand B>\
+    auto operator OP_SYMBOL(const A& operand1, const B& operand2)\
+    requires ((tensor_expression<A> || tensor_expression<B>) &&\
+        requires (expression_value_t<A> a, expression_value_t<B> b) {a OP_SYMBOL b;}){\
+        return make_binary_expression(operand1, operand2,\
+            [](const auto& item1, const auto& item2) -> decltype(materialize_expression(item1 OP_SYMBOL item2)){\
+                return materialize_expression(item1 OP_SYMBOL item2);\
+            }\
+        );\
+    }
+
+#define EXPRESSION_BINARY_EoVrE(OP_SYMBOL)\
+    template<tensor_expression E>\
+    auto operator OP_SYMBOL(const E& expression, const expression_value_t<E>& value)\
+    requires requires (expression_value_t<E> a, expression_value_t<E> b) {a OP_SYMBOL b;}{\
+        return make_binary_expression(expression, value,\
+            [](const auto& item1, const auto& item2) -> decltype(materialize_expression(item1 OP_SYMBOL item2)){\
+                return materialize_expression(item1 OP_SYMBOL item2);\
+            }\
+        );\
+    }
+
+#define EXPRESSION_BINARY_VoErE(OP_SYMBOL)\
+    template<tensor_expression E>\
+    auto operator OP_SYMBOL(const expression_value_t<E>& value, const E& expression)\
+    requires requires (expression_value_t<E> a, expression_value_t<E> b) {a OP_SYMBOL b;}{\
+        return make_binary_expression(value, expression,\
+            [](const auto& item1, const auto& item2) -> decltype(materialize_expression(item1 OP_SYMBOL item2)){\
+                return materialize_expression(item1 OP_SYMBOL item2);\
+            }\
+        );\
+    }
+
+#define EXPRESSION_BINARY_ToeE(OP_SYMBOL)\
+    template<operation_tensor D, tensor_expression E>\
+    void operator OP_SYMBOL##=(D& tensor, const E& expression)\
+    requires requires (expression_value_t<D> a, expression_value_t<E> b) {a OP_SYMBOL##= b;}{\
+        tensor.apply(expression, [](expression_value_t<D>& item, const expression_value_t<E>& value){\
+            item OP_SYMBOL##= value;\
+        }, ExecutionPolicy::parallel);\
+    }
+
+#define EXPRESSION_BINARY(OP_SYMBOL)\
+    EXPRESSION_BINARY_EoXrE(OP_SYMBOL)\
+    EXPRESSION_BINARY_EoVrE(OP_SYMBOL)\
+    EXPRESSION_BINARY_VoErE(OP_SYMBOL)\
+    EXPRESSION_BINARY_ToeE(OP_SYMBOL)
+
+EXPRESSION_BINARY(+)
+EXPRESSION_BINARY(-)
+EXPRESSION_BINARY(*)
+EXPRESSION_BINARY(/)
+EXPRESSION_BINARY(|)
+EXPRESSION_BINARY(&)
+EXPRESSION_BINARY(^)
+EXPRESSION_BINARY(%)
+
+#define EXPRESSION_LOGICAL(OP_SYMBOL)\
+    EXPRESSION_BINARY_EoXrE(OP_SYMBOL)\
+    EXPRESSION_BINARY_EoVrE(OP_SYMBOL)\
+    EXPRESSION_BINARY_VoErE(OP_SYMBOL)
+
+EXPRESSION_LOGICAL(&&)
+EXPRESSION_LOGICAL(||)
+
+#define EXPRESSION_BITSHIFTLIKE(OP_SYMBOL)\
+    EXPRESSION_BINARY_EoXrE(OP_SYMBOL)\
+    EXPRESSION_BINARY_EoVrE(OP_SYMBOL)\
+    EXPRESSION_BINARY_ToeE(OP_SYMBOL)
+
+EXPRESSION_BITSHIFTLIKE(<<)
+EXPRESSION_BITSHIFTLIKE(>>)
+
+#undef EXPRESSION_BINARY_EoXrE
+#undef EXPRESSION_BINARY_EoVrE
+#undef EXPRESSION_BINARY_VoErE
+#undef EXPRESSION_BINARY_ToeE
+
+#undef EXPRESSION_BITSHIFTLIKE
+#undef EXPRESSION_LOGICAL
+
+#undef EXPRESSION_BINARY
+
+}
+
+#include "TensorExpression.tpp"
+
+#endif
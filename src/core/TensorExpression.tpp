@@ -0,0 +1,206 @@
+#include "TensorExpression.hpp"
+
+namespace gema {
+
+// TENSOR REFERENCE: ----------------------------------------------------------------------------------------------------------
+
+template<typename TensorT>
+TensorReference<TensorT>::TensorReference(const TensorT& tensor)
+: tensor_(&tensor), data_(tensor.getData()){}
+
+template<typename TensorT>
+const typename TensorReference<TensorT>::value_type& TensorReference<TensorT>::evaluateItem(const uint64_t itemIndex) const{
+    return data_[itemIndex];
+}
+
+#ifdef GEMA_SIMD
+template<typename TensorT>
+template <typename Flags>
+auto TensorReference<TensorT>::evaluatePack(const uint64_t itemIndex, Flags flags) const requires simd_item<value_type>{
+    return simd_pack<value_type>(data_ + itemIndex, flags);
+}
+#endif
+
+template<typename TensorT>
+const TensorT& TensorReference<TensorT>::getOperandTensor() const{
+    return *tensor_;
+}
+
+template<typename TensorT>
+template <typename F>
+void TensorReference<TensorT>::forEachOperandTensor(F&& function) const{
+    function(*tensor_);
+}
+
+
+
+// SCALAR OPERAND: ------------------------------------------------------------------------------------------------------------
+
+template<typename V>
+ScalarOperand<V>::ScalarOperand(const V& value)
+: value_(value){}
+
+template<typename V>
+const V& ScalarOperand<V>::evaluateItem(const uint64_t /*itemIndex*/) const{
+    return value_;
+}
+
+#ifdef GEMA_SIMD
+template<typename V>
+template <typename Flags>
+auto ScalarOperand<V>::evaluatePack(const uint64_t /*itemIndex*/, Flags /*flags*/) const requires simd_item<V>{
+    return simd_pack<V>(value_);
+}
+#endif
+
+template<typename V>
+template <typename F>
+void ScalarOperand<V>::forEachOperandTensor(F&& /*function*/) const{
+
+}
+
+
+
+// TENSOR EXPRESSION: ---------------------------------------------------------------------------------------------------------
+
+template<typename Expression>
+uint64_t TensorExpression<Expression>::getNumberOfItems() const{
+    return self().getOperandTensor().getNumberOfItems();
+}
+
+template<typename Expression>
+decltype(auto) TensorExpression<Expression>::getDimensionSizes() const{
+    return self().getOperandTensor().getDimensionSizes();
+}
+
+template<typename Expression>
+auto TensorExpression<Expression>::evaluate() const{
+    using Result = typename Expression::tensor_type::template rebind<typename Expression::value_type>;
+    return Result(self());
+}
+
+template<typename Expression>
+bool TensorExpression<Expression>::hasMatchingOperands() const{
+
+    const auto& dimensionSizes = getDimensionSizes();
+
+    bool matching = true;
+    self().forEachOperandTensor([&](const auto& operand){
+        matching = matching && std::ranges::equal(span_view<uint64_t>(operand.getDimensionSizes()), 
+            span_view<uint64_t>(dimensionSizes));
+    });
+
+    return matching;
+}
+
+
+
+// BINARY EXPRESSION: ---------------------------------------------------------------------------------------------------------
+
+template<typename Operation, typename Operand1, typename Operand2>
+BinaryExpression<Operation, Operand1, Operand2>::BinaryExpression(const Operand1& operand1, const Operand2& operand2, const Operation& operation)
+: operand1_(operand1), operand2_(operand2), operation_(operation){}
+
+template<typename Operation, typename Operand1, typename Operand2>
+typename BinaryExpression<Operation, Operand1, Operand2>::value_type BinaryExpression<Operation, Operand1, Operand2>::evaluateItem(const uint64_t itemIndex) const{
+    return operation_(operand1_.evaluateItem(itemIndex), operand2_.evaluateItem(itemIndex));
+}
+
+#ifdef GEMA_SIMD
+template<typename Operation, typename Operand1, typename Operand2>
+template <typename Flags>
+auto BinaryExpression<Operation, Operand1, Operand2>::evaluatePack(const uint64_t itemIndex, Flags flags) const 
+requires simd_operation<Operation, Operand1, Operand2>{
+    return operation_(operand1_.evaluatePack(itemIndex, flags), operand2_.evaluatePack(itemIndex, flags));
+}
+#endif
+
+template<typename Operation, typename Operand1, typename Operand2>
+const typename BinaryExpression<Operation, Operand1, Operand2>::tensor_type& BinaryExpression<Operation, Operand1, Operand2>::getOperandTensor() const{
+    if constexpr(has_operand_tensor<Operand1>){
+        return operand1_.getOperandTensor();
+    }else{
+        return operand2_.getOperandTensor();
+    }
+}
+
+template<typename Operation, typename Operand1, typename Operand2>
+template <typename F>
+void BinaryExpression<Operation, Operand1, Operand2>::forEachOperandTensor(F&& function) const{
+    operand1_.forEachOperandTensor(function);
+    operand2_.forEachOperandTensor(function);
+}
+
+
+
+// UNARY EXPRESSION: ----------------------------------------------------------------------------------------------------------
+
+template<typename Operation, typename Operand>
+UnaryExpression<Operation, Operand>::UnaryExpression(const Operand& operand, const Operation& operation)
+: operand_(operand), operation_(operation){}
+
+template<typename Operation, typename Operand>
+typename UnaryExpression<Operation, Operand>::value_type UnaryExpression<Operation, Operand>::evaluateItem(const uint64_t itemIndex) const{
+    return operation_(operand_.evaluateItem(itemIndex));
+}
+
+#ifdef GEMA_SIMD
+template<typename Operation, typename Operand>
+template <typename Flags>
+auto UnaryExpression<Operation, Operand>::evaluatePack(const uint64_t itemIndex, Flags flags) const 
+requires simd_operation<Operation, Operand>{
+    return operation_(operand_.evaluatePack(itemIndex, flags));
+}
+#endif
+
+template<typename Operation, typename Operand>
+const typename UnaryExpression<Operation, Operand>::tensor_type& UnaryExpression<Operation, Operand>::getOperandTensor() const{
+    return operand_.getOperandTensor();
+}
+
+template<typename Operation, typename Operand>
+template <typename F>
+void UnaryExpression<Operation, Operand>::forEachOperandTensor(F&& function) const{
+    operand_.forEachOperandTensor(function);
+}
+
+
+
+// HELPERS: -------------------------------------------------------------------------------------------------------------------
+
+template <typename X>
+auto make_expression_operand(const X& operand){
+    if constexpr(tensor_expression<X>){
+        return operand;
+    }else if constexpr(operation_tensor<X>){
+        return TensorReference<X>(operand);
+    }else{
+        return ScalarOperand<X>(operand);
+    }
+}
+
+template <typename Operation, typename A, typename B>
+auto make_binary_expression(const A& operand1, const B& operand2, const Operation& operation){
+    using Operand1 = decltype(make_expression_operand(operand1));
+    using Operand2 = decltype(make_expression_operand(operand2));
+    return BinaryExpression<Operation, Operand1, Operand2>(
+        make_expression_operand(operand1), make_expression_operand(operand2), operation
+    );
+}
+
+template <typename Operation, typename A>
+auto make_unary_expression(const A& operand, const Operation& operation){
+    using Operand = decltype(make_expression_operand(operand));
+    return UnaryExpression<Operation, Operand>(make_expression_operand(operand), operation);
+}
+
+template <typename V>
+auto materialize_expression(V&& value){
+    if constexpr(tensor_expression<V>){
+        return value.evaluate();
+    }else{
+        return std::forward<V>(value);
+    }
+}
+
+}
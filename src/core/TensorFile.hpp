@@ -0,0 +1,167 @@
+#ifndef TENSOR_FILE_HPP
+#define TENSOR_FILE_HPP
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+#include "MemoryBackend.hpp"
+#include "MemoryBackendConcept.hpp"
+#include "MemoryBackendMapped.hpp"
+#include "Tensor.hpp"
+
+namespace gema {
+
+/// Type of items stored in tensor file.
+enum class TensorFileType : uint32_t {
+    unknown = 0,
+    int8, uint8, int16, uint16, int32, uint32, int64, uint64,
+    float32, float64,
+    boolean
+};
+
+/** ---------------------------------------------------------------------------------------------------------------------------
+ * @brief Gets file type of items of type T.
+ *
+ * @tparam T type of items.
+ *
+ * @return Type of items in file, unknown if T can not be stored.
+ */
+template <class T>
+constexpr TensorFileType tensorFileType();
+
+/// Types of items that can be stored in tensor file.
+template <class T>
+concept tensor_file_item = (tensorFileType<T>() != TensorFileType::unknown);
+
+/**
+ * @brief Header at the beginning of tensor file.
+ *
+ * @par
+ * File layout is the header, then rank 64-bit dimension sizes, then zero padding and then raw items starting at dataOffset,
+ * which is a multiple of alignment. All numbers are in byte order of the machine that wrote the file. Items are laid out
+ * the same way as in Tensor, so mapping the file gives tensor data directly.
+ */
+struct TensorFileHeader {
+    /// File signature, "GEMATNSR".
+    char magic[8];
+    /// Version of the layout.
+    uint32_t version;
+    /// TensorFileType of items.
+    uint32_t itemType;
+    /// Size of one item in bytes.
+    uint32_t itemSize;
+    /// Number of dimensions.
+    uint32_t rank;
+    /// Alignment of items in bytes.
+    uint64_t alignment;
+    /// Offset of the first item from the beginning of the file.
+    uint64_t dataOffset;
+    /// Number of items.
+    uint64_t itemCount;
+    /// Checksum of the items, see tensorFileChecksum.
+    uint64_t checksum;
+};
+
+static_assert(sizeof(TensorFileHeader) == 56 && std::is_trivially_copyable_v<TensorFileHeader>);
+
+/// Signature of tensor file.
+inline constexpr char tensorFileMagic[8] = {'G', 'E', 'M', 'A', 'T', 'N', 'S', 'R'};
+
+/// Version of the layout written by saveTensor.
+inline constexpr uint32_t tensorFileVersion = 1;
+
+/// Alignment of items in the file, the same as alignment of MemoryBackend.
+inline constexpr uint64_t tensorFileAlignment = 64;
+
+/**
+ * @brief Checksum of tensor file items computed from consecutive parts of them, see tensorFileChecksum.
+ */
+class TensorFileChecksumState {
+
+    uint64_t checksum_ = 14695981039346656037ull;
+    // Bytes of incomplete word from the end of the last part
+    uint64_t pendingWord_ = 0;
+    uint64_t pendingBytes_ = 0;
+
+    void addWord(const uint64_t word);
+
+    public:
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Adds next bytes, parts may be split anywhere, even inside of items.
+     *
+     * @param data the bytes.
+     * @param byteCount number of bytes.
+     */
+    void update(const void* data, const uint64_t byteCount);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Gets checksum of all bytes added so far.
+     *
+     * @return The checksum.
+     */
+    uint64_t get() const;
+};
+
+/** ---------------------------------------------------------------------------------------------------------------------------
+ * @brief Computes checksum of items in file. It is FNV-1a over 64-bit words, last incomplete word is padded by zeros.
+ *
+ * @param data bytes of the items.
+ * @param byteCount number of bytes.
+ *
+ * @return The checksum.
+ */
+uint64_t tensorFileChecksum(const void* data, const uint64_t byteCount);
+
+/** ---------------------------------------------------------------------------------------------------------------------------
+ * @brief Writes tensor into file in the format described by TensorFileHeader. Tensors with items in other than host memory
+ * are copied to host first.
+ *
+ * @param path path of the file, existing file is overwritten.
+ * @param tensor written tensor.
+ *
+ * @return Bool @b true if the whole file was written.
+ */
+template <tensor_file_item T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+bool saveTensor(const std::string& path, const Tensor<T, DataMB, MetadataMB>& tensor);
+
+/** ---------------------------------------------------------------------------------------------------------------------------
+ * @brief Reads and checks header of tensor file, without reading the items.
+ *
+ * @param path path of the file.
+ *
+ * @return Header, or nothing if the file is not a valid tensor file.
+ */
+std::optional<TensorFileHeader> readTensorFileHeader(const std::string& path);
+
+/** ---------------------------------------------------------------------------------------------------------------------------
+ * @brief Opens tensor file by mapping it into memory, items are not copied nor read until they are accessed. The checksum
+ * is not checked, because that would read whole file, use verifyTensorFile for that.
+ *
+ * @par
+ * Copies of the tensor and operations returning new tensors have their items in ordinary host memory.
+ *
+ * @param path path of the file.
+ * @param writable if @b true, changes of items are written to the file, otherwise they stay in memory only.
+ *
+ * @return Tensor with items in the file, or nothing if the file can not be mapped, is not valid or has items of other type.
+ */
+template <tensor_file_item T>
+std::optional<Tensor<T, MemoryBackendMapped<T>>> openTensor(const std::string& path, const bool writable = false);
+
+/** ---------------------------------------------------------------------------------------------------------------------------
+ * @brief Checks header and checksum of tensor file, which reads the whole file.
+ *
+ * @param path path of the file.
+ *
+ * @return Bool @b true if the file is valid tensor file.
+ */
+bool verifyTensorFile(const std::string& path);
+
+}
+
+#include "TensorFile.tpp"
+
+#endif
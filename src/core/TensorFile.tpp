@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+#include "TensorFile.hpp"
+
+namespace gema {
+
+    template <class T>
+    constexpr TensorFileType tensorFileType(){
+
+        if constexpr (std::is_same_v<T, bool>){
+            return TensorFileType::boolean;
+        }else if constexpr (std::is_integral_v<T>){
+
+            constexpr bool isSigned = std::is_signed_v<T>;
+
+            if constexpr (sizeof(T) == 1) return isSigned ? TensorFileType::int8 : TensorFileType::uint8;
+            if constexpr (sizeof(T) == 2) return isSigned ? TensorFileType::int16 : TensorFileType::uint16;
+            if constexpr (sizeof(T) == 4) return isSigned ? TensorFileType::int32 : TensorFileType::uint32;
+            if constexpr (sizeof(T) == 8) return isSigned ? TensorFileType::int64 : TensorFileType::uint64;
+            return TensorFileType::unknown;
+
+        }else if constexpr (std::is_same_v<T, float>){
+            return TensorFileType::float32;
+        }else if constexpr (std::is_same_v<T, double>){
+            return TensorFileType::float64;
+        }else{
+            return TensorFileType::unknown;
+        }
+    }
+
+    namespace detail {
+
+        inline uint64_t tensorFileDataOffset(const uint64_t rank){
+            const uint64_t metadataEnd = sizeof(TensorFileHeader) + rank * sizeof(uint64_t);
+            return (metadataEnd + tensorFileAlignment - 1) / tensorFileAlignment * tensorFileAlignment;
+        }
+
+        // Checks everything that does not need the dimension sizes nor the items
+        inline bool isValidTensorFileHeader(const TensorFileHeader& header, const uint64_t fileSize){
+
+            if(std::memcmp(header.magic, tensorFileMagic, sizeof(tensorFileMagic)) != 0) return false;
+            if(header.version != tensorFileVersion) return false;
+            if(header.itemSize == 0 || header.alignment == 0 || header.dataOffset % header.alignment != 0) return false;
+            if(header.dataOffset < sizeof(TensorFileHeader) + uint64_t(header.rank) * sizeof(uint64_t)) return false;
+
+            // Written so that it can not overflow
+            if(header.dataOffset > fileSize) return false;
+            return header.itemCount <= (fileSize - header.dataOffset) / header.itemSize;
+        }
+
+        // Header of file with given items, without checksum
+        template <class T>
+        TensorFileHeader makeTensorFileHeader(const uint64_t rank, const uint64_t itemCount){
+
+            TensorFileHeader header{};
+            std::memcpy(header.magic, tensorFileMagic, sizeof(tensorFileMagic));
+            header.version = tensorFileVersion;
+            header.itemType = static_cast<uint32_t>(tensorFileType<T>());
+            header.itemSize = sizeof(T);
+            header.rank = static_cast<uint32_t>(rank);
+            header.alignment = tensorFileAlignment;
+            header.dataOffset = tensorFileDataOffset(rank);
+            header.itemCount = itemCount;
+            return header;
+        }
+
+        inline bool hasMatchingItemCount(const TensorFileHeader& header, const uint64_t* dimensionSizes){
+
+            // Tensor without dimensions is a scalar, which has one item. Sizes whose product does not fit into 64 bits come
+            // from a damaged or crafted header and must not wrap around to the stored count.
+            uint64_t itemCount = 1;
+            bool overflow = false;
+            for(uint64_t i = 0; i < header.rank; ++i){
+
+                if(dimensionSizes[i] == 0) return header.itemCount == 0;
+
+                overflow = overflow || itemCount > std::numeric_limits<uint64_t>::max() / dimensionSizes[i];
+                itemCount *= dimensionSizes[i];
+            }
+            return !overflow && itemCount == header.itemCount;
+        }
+    }
+
+    inline void TensorFileChecksumState::addWord(const uint64_t word){
+
+        constexpr uint64_t prime = 1099511628211ull;
+        checksum_ = (checksum_ ^ word) * prime;
+    }
+
+    inline void TensorFileChecksumState::update(const void* data, uint64_t byteCount){
+
+        const std::byte* bytes = static_cast<const std::byte*>(data);
+
+        // Completes the word started by the previous part
+        if(pendingBytes_ > 0){
+
+            const uint64_t taken = std::min(byteCount, sizeof(uint64_t) - pendingBytes_);
+            std::memcpy(reinterpret_cast<std::byte*>(&pendingWord_) + pendingBytes_, bytes, taken);
+            pendingBytes_ += taken;
+            bytes += taken;
+            byteCount -= taken;
+
+            if(pendingBytes_ < sizeof(uint64_t)) return;
+
+            addWord(pendingWord_);
+            pendingWord_ = 0;
+            pendingBytes_ = 0;
+        }
+
+        const uint64_t wordCount = byteCount / sizeof(uint64_t);
+        for(uint64_t i = 0; i < wordCount; ++i){
+            uint64_t word;
+            std::memcpy(&word, bytes + i * sizeof(uint64_t), sizeof(uint64_t));
+            addWord(word);
+        }
+
+        pendingBytes_ = byteCount - wordCount * sizeof(uint64_t);
+        std::memcpy(&pendingWord_, bytes + wordCount * sizeof(uint64_t), pendingBytes_);
+    }
+
+    inline uint64_t TensorFileChecksumState::get() const{
+
+        // Incomplete word is padded by zeros, which pendingWord_ already has
+        if(pendingBytes_ == 0) return checksum_;
+
+        TensorFileChecksumState finished = *this;
+        finished.addWord(pendingWord_);
+        return finished.checksum_;
+    }
+
+    inline uint64_t tensorFileChecksum(const void* data, const uint64_t byteCount){
+
+        TensorFileChecksumState checksum;
+        checksum.update(data, byteCount);
+        return checksum.get();
+    }
+
+    template <tensor_file_item T, MemoryBackendConcept<T> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    bool saveTensor(const std::string& path, const Tensor<T, DataMB, MetadataMB>& tensor){
+
+        const auto& dimensionSizes = tensor.getDimensionSizes();
+        const uint64_t rank = dimensionSizes.size();
+        const uint64_t itemCount = tensor.getNumberOfItems();
+
+        // Items in device memory can not be written directly
+        LinearContainer<T> hostItems;
+        const T* items = tensor.getData();
+        if constexpr (!std::is_same_v<DataMB, MemoryBackend<T>> && !std::is_same_v<DataMB, MemoryBackendMapped<T>>){
+            hostItems = tensor.getDataContainer().copyToBackend(MemoryBackend<T>());
+            items = hostItems.data();
+        }
+
+        TensorFileHeader header = detail::makeTensorFileHeader<T>(rank, itemCount);
+        header.checksum = tensorFileChecksum(items, itemCount * sizeof(T));
+
+        std::vector<uint64_t> metadata(rank);
+        std::copy_n(dimensionSizes.data(), rank, metadata.data());
+
+        const std::vector<char> padding(header.dataOffset - sizeof(TensorFileHeader) - rank * sizeof(uint64_t), 0);
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(metadata.data()), rank * sizeof(uint64_t));
+        file.write(padding.data(), padding.size());
+        file.write(reinterpret_cast<const char*>(items), itemCount * sizeof(T));
+        file.close();
+
+        return !file.fail();
+    }
+
+    inline std::optional<TensorFileHeader> readTensorFileHeader(const std::string& path){
+
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if(!file) return std::nullopt;
+
+        const uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+        if(fileSize < sizeof(TensorFileHeader)) return std::nullopt;
+
+        TensorFileHeader header;
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+        if(!file || !detail::isValidTensorFileHeader(header, fileSize)) return std::nullopt;
+
+        std::vector<uint64_t> dimensionSizes(header.rank);
+        file.read(reinterpret_cast<char*>(dimensionSizes.data()), header.rank * sizeof(uint64_t));
+
+        if(!file || !detail::hasMatchingItemCount(header, dimensionSizes.data())) return std::nullopt;
+
+        return header;
+    }
+
+    template <tensor_file_item T>
+    std::optional<Tensor<T, MemoryBackendMapped<T>>> openTensor(const std::string& path, const bool writable){
+
+        std::shared_ptr<MappedFile> file = MappedFile::open(path, writable);
+        if(!file || file->size() < sizeof(TensorFileHeader)) return std::nullopt;
+
+        TensorFileHeader header;
+        std::memcpy(&header, file->data(), sizeof(header));
+
+        if(!detail::isValidTensorFileHeader(header, file->size())) return std::nullopt;
+        if(header.itemType != static_cast<uint32_t>(tensorFileType<T>()) || header.itemSize != sizeof(T)) return std::nullopt;
+        if(header.alignment % alignof(T) != 0) return std::nullopt;
+
+        // Scalar has no dimension sizes and its container has no memory to copy into
+        LinearContainer<uint64_t> dimensionSizes(header.rank);
+        if(header.rank > 0){
+            std::memcpy(dimensionSizes.data(), file->data() + sizeof(TensorFileHeader), header.rank * sizeof(uint64_t));
+        }
+
+        if(!detail::hasMatchingItemCount(header, dimensionSizes.data())) return std::nullopt;
+
+        // Construction allocates exactly itemCount items, which the backend serves from the file
+        return Tensor<T, MemoryBackendMapped<T>>(dimensionSizes,
+            MemoryBackendMapped<T>(std::move(file), header.dataOffset, header.itemCount));
+    }
+
+    inline bool verifyTensorFile(const std::string& path){
+
+        const std::optional<TensorFileHeader> header = readTensorFileHeader(path);
+        if(!header) return false;
+
+        const std::shared_ptr<MappedFile> file = MappedFile::open(path);
+        if(!file) return false;
+
+        const uint64_t byteCount = header->itemCount * header->itemSize;
+        return tensorFileChecksum(file->data() + header->dataOffset, byteCount) == header->checksum;
+    }
+}
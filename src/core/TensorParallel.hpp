@@ -1,10 +1,14 @@
 #ifndef TENSOR_PARALLEL_HPP
 #define TENSOR_PARALLEL_HPP
 
+#include <vector>
+
 #include <sycl/sycl.hpp>
 
 #include "MemoryBackendConcept.hpp"
 #include "MemoryBackendUSM.hpp"
+#include "QueueRegistry.hpp"
+#include "TransferUSM.hpp"
 #include "TensorConcept.hpp"
 #include "Tensor.hpp"
 
@@ -26,6 +30,10 @@ concept tensor_or_t_or_bothtensor_parallel =
     (std::is_same_v<std::remove_cvref_t<A>, TensorParallel<T>> && std::is_same_v<std::remove_cvref_t<B>, T>) ||
     (std::is_same_v<std::remove_cvref_t<A>, T> && std::is_same_v<std::remove_cvref_t<B>, TensorParallel<T>>);
 
+// Checks if type is lazy expression whose tensor operands are all TensorParallel, so it can be evaluated inside kernels.
+template <typename E>
+concept parallel_expression = tensor_expression<E> && expression_over_v<TensorParallel, std::remove_cvref_t<E>>;
+
 
 template<class T>
 class TensorParallel : /*public Tensor<T>,*/public AbstractOperation<TensorParallel<T>>{
@@ -33,7 +41,8 @@ class TensorParallel : /*public Tensor<T>,*/public AbstractOperation<TensorParal
     static_assert(sycl::is_device_copyable_v<T>);
     static_assert(std::is_trivially_copyable_v<T>);
 
-    inline static sycl::queue queueGlobal_{sycl::property::queue::in_order{}};
+    // Shared in-order queue of the default device (see QueueRegistry), used by tensors not bound to other queue
+    static sycl::queue* getGlobalQueue();
 
     constexpr static sycl::usm::alloc usmDataKind_ = sycl::usm::alloc::device;
     constexpr static sycl::usm::alloc usmMetadataKind_ = sycl::usm::alloc::shared;
@@ -42,17 +51,89 @@ class TensorParallel : /*public Tensor<T>,*/public AbstractOperation<TensorParal
     using MetadataBackend = MemoryBackendUSM<uint64_t, usmMetadataKind_>;
 
     using DataContainer = LinearContainer<T, DataBackend>;
-    using MetadataContainer = LinearContainer<uint64_t, MetadataBackend>;
+    using MetadataContainer = typename Tensor<T, DataBackend, MetadataBackend>::MetadataContainer;
 
-    sycl::queue* queue_ = &queueGlobal_;
+    sycl::queue* queue_ = getGlobalQueue();
 
     Tensor<T, DataBackend, MetadataBackend> tensor_{DataBackend(queue_), MetadataBackend(queue_)};
 
+    // Event of the last kernel that writes or reads data of this tensor. Kernels are submitted without waiting, each one
+    // depends on events of tensors it works with and the host waits only when it needs to access the data.
+    mutable sycl::event lastEvent_;
+
+    // Optional copy of items in host memory for repeated reads. Every change of data on device marks it stale and readers
+    // copy items again only when it is stale. Writes of single items from host update it instead.
+    bool hostMirrorEnabled_ = false;
+    mutable bool hostMirrorValid_ = false;
+    mutable LinearContainer<T> hostMirror_;
+
+    // Called by everything that writes data of this tensor, including handing out non-const pointer to them
+    void markDataChanged();
+
+    const LinearContainer<T>& refreshHostMirror() const;
+
+    template <typename U>
+    friend class TensorParallel;
+
+    template <typename U>
+    friend class MatrixParallel;
+
+    template <typename U>
+    friend class TensorSharded;
+
+    template <typename K>
+    sycl::event parallelFor(const uint64_t itemCount, const std::vector<sycl::event>& dependencies, K&& kernel) const;
+
+    // Replaces data by the result of reduceItems(firstItem, count, stride) for every item of tensor without given dimension
+    template <typename F>
+    void reduceDimension(const uint64_t dimensionIndex, F&& reduceItems);
+
+    // Queue of the first tensor operand of expression, so its result stays where the operands are
+    template <tensor_expression E>
+    static sycl::queue* getExpressionQueue(const E& expression);
+
+    // Copies items from host memory into the tensor by chunks. Only the host part waits, the copy of the last chunks is
+    // left to lastEvent_, so kernels on the new tensor are submitted while it runs.
+    void uploadItems(const LinearContainer<T>& items);
+
+    // Changes dimension sizes and moves every item to the index of its new coordinates. Item on new coordinates c comes from
+    // index sum(c[d] * sourceJumps[d]) if c[d] < sourceLimits[d] for every d, otherwise it is T{}. When keepsPrefix is true,
+    // the items already are on their new indices, so the container is only resized and nothing is moved.
+    void reshapeItems(const LinearContainer<uint64_t>& newDimensionSizes, const LinearContainer<uint64_t>& sourceJumps, 
+    const LinearContainer<uint64_t>& sourceLimits, const bool keepsPrefix);
+
+    // Jumps on flattened data corresponding to one increment of every coordinate
+    LinearContainer<uint64_t> getDimensionJumps() const;
+
+    // Maximal side of square tiles of transposition kernel
+    constexpr static uint64_t transposeTileSide_ = 16;
+
+    // Writes source items of given dimension sizes into destination with dimensions dim1 and dim2 swapped. Items are viewed
+    // as [outer][dim1][middle][dim2][inner] block, so no coordinates are computed for any rank. When the inner block is
+    // a single item, reads and writes go through square tiles in local memory, so both of them are coalesced.
+    sycl::event transposeItems(const T* source, T* destination, span_view<uint64_t> dimensionSizes, uint64_t dim1, 
+    uint64_t dim2, const std::vector<sycl::event>& dependencies) const;
+
+    // Maximal number of dimensions of tensor for which forEachWithCoords keeps coordinates in private memory of this size
+    constexpr static uint64_t maxKernelDimensions_ = 16;
+
+    // Maximal number of work-items of forEachWithCoords on tensors of more dimensions, every one of them keeps its
+    // coordinates in shared memory and walks a contiguous part of the box
+    constexpr static uint64_t maxCoordsWorkItems_ = uint64_t(1) << 14;
+
+    // Part of forEachWithCoords for tensors of more than maxKernelDimensions_ dimensions, box is valid and not empty
+    template <typename C>
+    void forEachWithCoordsShared(C&& operation, span_view<uint64_t> boxBegin, span_view<uint64_t> boxEnd,
+    uint64_t boxItemCount);
+
     public:
 
     template<typename U>
     using type = TensorParallel<U>;
 
+    template<typename U>
+    using rebind = TensorParallel<U>;
+
     using value_type = T;
     //using memory_backend = MemoryBackendUSM<T, sycl::usm::alloc::device>;
 
@@ -65,6 +146,13 @@ class TensorParallel : /*public Tensor<T>,*/public AbstractOperation<TensorParal
 
     TensorParallel(const LinearContainer<uint64_t>& newDimensionSizes, const LinearContainer<T>& newData);// = delete;
 
+    // Tensor that lives on given queue instead of the global one, the queue must outlive the tensor (see QueueRegistry).
+    // Tensors made from this one by copies and operations stay on the same queue. Operands on other queues of the same
+    // context are waited for through their events, out-of-order queues are ordered the same way.
+    TensorParallel(const LinearContainer<uint64_t>& newDimensionSizes, sycl::queue* queue);
+
+    TensorParallel(const LinearContainer<uint64_t>& newDimensionSizes, const LinearContainer<T>& newData, sycl::queue* queue);
+
     TensorParallel(const TensorParallel<T>& otherTensor);
 
     TensorParallel(TensorParallel<T>&& otherTensor) noexcept;
@@ -72,6 +160,11 @@ class TensorParallel : /*public Tensor<T>,*/public AbstractOperation<TensorParal
     template <typename OtherTensor>
     TensorParallel(OtherTensor* otherTensor);
 
+    // Evaluates lazy expression created by operator overloads in single kernel, all operands must be TensorParallel of
+    // the same shape
+    template <parallel_expression E>
+    TensorParallel(const E& expression);
+
     TensorParallel();
 
     ~TensorParallel();
@@ -80,6 +173,9 @@ class TensorParallel : /*public Tensor<T>,*/public AbstractOperation<TensorParal
     
     TensorParallel<T>& operator=(TensorParallel<T>&& otherTensor) noexcept;
 
+    template <parallel_expression E>
+    TensorParallel<T>& operator=(const E& expression);
+
 
 
     const MetadataContainer& getDimensionSizes() const;
@@ -89,13 +185,54 @@ class TensorParallel : /*public Tensor<T>,*/public AbstractOperation<TensorParal
     uint64_t getNumberOfItems() const;
 
     const Tensor<T, DataBackend, MetadataBackend>& getTensor() const;
-    sycl::queue* getQueue();
+    sycl::queue* getQueue() const;
+
+    // Waits until all submitted kernels working with this tensor are finished. Needed before accessing raw data from
+    // getData() outside of the queue, other methods synchronize by themselves.
+    void sync() const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Turns host mirror on or off. With the mirror getItem, getItems, toString and getHostItems read items from host
+     * memory and copy them from device only if they changed since the last read, so repeated reads of unchanged tensor
+     * cost no transfer. Mirror takes the same memory as the items, turning it off releases it.
+     *
+     * @param enabled whether the mirror is kept.
+     */
+    void setHostMirror(const bool enabled);
+
+    bool hasHostMirror() const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Gets all items in host memory. Without host mirror they are copied on every call.
+     *
+     * @return Items valid until the next change of the tensor.
+     */
+    const LinearContainer<T>& getHostItems() const;
 
 
     T getItem(span_view<uint64_t> coordinates);
 
     void setItem(const T& value, span_view<uint64_t> coordinates);
 
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Gets many items at once. Indices are computed on host, then one kernel gathers all items into staging buffer
+     * in host memory, so there is a single round trip to the device no matter how many items are read.
+     *
+     * @param coordinatesList coordinates of all items one after another, each item takes number of dimensions values.
+     *
+     * @return Items in the order of their coordinates.
+     */
+    LinearContainer<T> getItems(span_view<uint64_t> coordinatesList);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Sets many items at once in one kernel, that scatters values from staging buffer in host memory. If the same
+     * coordinates are given more than once, it is unspecified which of their values is stored.
+     *
+     * @param coordinatesList coordinates of all items one after another, each item takes number of dimensions values.
+     * @param values values in the order of their coordinates.
+     */
+    void setItems(span_view<uint64_t> coordinatesList, span_view<T> values);
+
     T* getData();
     const T* getData() const;
 
@@ -126,6 +263,8 @@ class TensorParallel : /*public Tensor<T>,*/public AbstractOperation<TensorParal
 
     void transposition(const uint64_t dim1 = 0, const uint64_t dim2 = 1);
 
+    // Keeps items on valid coordinates, new ones are T{}. Throws std::invalid_argument if the number of dimensions differs,
+    // addDimension and removeDimension change it.
     void resize(const LinearContainer<uint64_t>& newDimensionSizes);
 
     void resize(const uint64_t newDimensionSize, const uint64_t dimensionIndex);
@@ -134,6 +273,18 @@ class TensorParallel : /*public Tensor<T>,*/public AbstractOperation<TensorParal
 
     void removeDimension(const uint64_t removedDimensionIndex);
 
+    template <apply_callable_parallel<T> C>
+    void collapseDimension(const uint64_t dimensionIndex, const C& binaryOperation);
+
+    // Standard operations with known identity (sycl::plus, sycl::minimum...) use sycl::reduction, other operations use
+    // work-group tree reduction in local memory that keeps items in index order. Only one partial result per work-group is
+    // copied to host.
+    template <reduce_callable_parallel<T> C>
+    T reduce(C&& operation, const T& init) const;
+
+    template <reduce_callable_parallel<T> C>
+    void reduce(const uint64_t dimensionIndex, C&& operation, const T& init);
+
 
 
     template <apply_and_return_callable_parallel<T> C>
@@ -143,8 +294,12 @@ class TensorParallel : /*public Tensor<T>,*/public AbstractOperation<TensorParal
     static auto applyAndReturn(const A& operand1, const B& operand2, C&& operation)
     requires(tensor_or_t_or_bothtensor_parallel<A, B, T>);
 
+    // Kernels always run in parallel, policy is accepted only to have the same interface as Tensor
     template <apply_callable_parallel<T> C>
-    void apply(const TensorParallel<T>& tensor2, C&& operation);
+    void apply(const TensorParallel<T>& tensor2, C&& operation, const ExecutionPolicy policy = ExecutionPolicy::parallel);
+
+    template <parallel_expression E, typename C>
+    void apply(const E& expression, C&& operation, const ExecutionPolicy policy = ExecutionPolicy::parallel);
 
     // template <typename A, typename B, apply_callable_parallel<T> C> 
     // static void apply(A& operand1, const B& operand2, C&& operation)
@@ -167,11 +322,37 @@ class TensorParallel : /*public Tensor<T>,*/public AbstractOperation<TensorParal
     static auto forEachAndReturn(const TensorParallel<T>& tensor, C&& operation);
 
     template <foreach_callable_parallel<T> C> 
-    void forEach(C&& operation);
+    void forEach(C&& operation, const ExecutionPolicy policy = ExecutionPolicy::parallel);
 
     template <foreach_callable_parallel<T> C>
     static void forEach(TensorParallel<T>& tensor, C&& operation);
 
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Applies operation on all items together with their coordinates. Every work-item decodes coordinates of its item
+     * from its id into private memory, nothing is allocated. Tensors of more than 16 dimensions keep coordinates in shared
+     * memory instead, every work-item walks a part of the items and moves its coordinates by carrying increments.
+     *
+     * @param operation callable as operation(T& item, span_view<uint64_t> coordinates), coordinates are valid only during
+     * the call. Tensor without dimensions calls it once with empty coordinates.
+     *
+     * @return Bool @b true, the same as the other overload for the whole tensor.
+     */
+    template <foreach_coord_callable_parallel<T> C>
+    bool forEachWithCoords(C&& operation);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Applies operation with coordinates only on items inside the box [boxBegin, boxEnd), see the other overload.
+     *
+     * @param operation callable as operation(T& item, span_view<uint64_t> coordinates), coordinates are of the whole tensor,
+     * not relative to the box.
+     * @param boxBegin inclusive coordinates of the first corner of the box.
+     * @param boxEnd exclusive coordinates of the opposite corner of the box.
+     *
+     * @return Bool @b false if the box does not fit into this tensor and nothing was done, otherwise @b true.
+     */
+    template <foreach_coord_callable_parallel<T> C>
+    bool forEachWithCoords(C&& operation, span_view<uint64_t> boxBegin, span_view<uint64_t> boxEnd);
+
     template <apply_to_item_callable<T> C>
     void applyToItem(span_view<uint64_t> coords, C&& operation);
 
@@ -1,16 +1,22 @@
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <stdexcept>
 #include <vector>
 
 #include <sycl/sycl.hpp>
 
 #include "TensorParallel.hpp"
 #include "MemoryBackendUSM.hpp"
+#include "MemoryPoolUSM.hpp"
 
 namespace gema{
    
     
     template <class T>
     TensorParallel<T>::TensorParallel(const LinearContainer<uint64_t>& newDimensionSizes)
-    : tensor_(newDimensionSizes.copyToBackend(MetadataBackend(queue_)), DataBackend(queue_)){
+    : tensor_(MetadataContainer(newDimensionSizes, MetadataBackend(queue_)), DataBackend(queue_)){
         // this->tensor_ = Tensor<T>(MemoryBackendUSM<T, usmDataKind_>(queue_));
         // this->dimensionSizes_ = LinearContainer<uint64_t>(newTensorDimensionSizes, MemoryBackendUSM<uint64_t, usmDataKind_>(queue_));
         // this->update();
@@ -31,30 +37,70 @@ namespace gema{
 
     template <class T>
     TensorParallel<T>::TensorParallel(const LinearContainer<uint64_t>& newDimensionSizes, const LinearContainer<T>& newData)
-    : tensor_(
-        newDimensionSizes.copyToBackend(MetadataBackend(queue_)),
-        newData.copyToBackend(DataBackend(queue_))
-    ){
+    : TensorParallel(newDimensionSizes){
+        uploadItems(newData);
+    }
+
+    template <class T>
+    TensorParallel<T>::TensorParallel(const LinearContainer<uint64_t>& newDimensionSizes, sycl::queue* queue)
+    : queue_(queue), tensor_(MetadataContainer(newDimensionSizes, MetadataBackend(queue_)), DataBackend(queue_)){
 
     }
 
+    template <class T>
+    TensorParallel<T>::TensorParallel(const LinearContainer<uint64_t>& newDimensionSizes, const LinearContainer<T>& newData,
+    sycl::queue* queue)
+    : TensorParallel(newDimensionSizes, queue){
+        uploadItems(newData);
+    }
+
     template <class T>
     TensorParallel<T>::TensorParallel(const TensorParallel<T>& otherTensor)
-    : tensor_(otherTensor.tensor_){
-        //queue_ = otherTensor.queue_;
+    : queue_(otherTensor.queue_), tensor_((otherTensor.sync(), otherTensor.tensor_)), 
+    hostMirrorEnabled_(otherTensor.hostMirrorEnabled_){
+        // Copy does not depend on events, so pending kernels of the copied tensor must finish before it on any queue
     }
 
     template <class T>
     TensorParallel<T>::TensorParallel(TensorParallel<T>&& otherTensor) noexcept 
-    : tensor_(std::move(otherTensor.tensor_)){
-        //queue_ = std::move(otherTensor.queue_);
+    : queue_(otherTensor.queue_), tensor_(std::move(otherTensor.tensor_)), lastEvent_(otherTensor.lastEvent_),
+    hostMirrorEnabled_(otherTensor.hostMirrorEnabled_), hostMirrorValid_(otherTensor.hostMirrorValid_), 
+    hostMirror_(std::move(otherTensor.hostMirror_)){
+
+        otherTensor.hostMirrorValid_ = false;
     }
 
     template <class T>
     template <typename OtherTensor>
     TensorParallel<T>::TensorParallel(OtherTensor* otherTensor)
-    : tensor_(&(otherTensor->getTensor())){
-        //*queue_ = otherTensor->getQueue();
+    : queue_(otherTensor->getQueue()), tensor_(&(otherTensor->getTensor())){
+
+    }
+
+    template <class T>
+    template <parallel_expression E>
+    TensorParallel<T>::TensorParallel(const E& expression)
+    : queue_(getExpressionQueue(expression)), tensor_(expression.getDimensionSizes(), DataBackend(queue_)){
+
+        if(!expression.hasMatchingOperands()){
+            throw std::invalid_argument("Operands of tensor expression have different dimension sizes");
+        }
+
+        T* resultRawData = getData();
+
+        std::vector<sycl::event> dependencies;
+        expression.forEachOperandTensor([&](const auto& operand){
+            dependencies.push_back(operand.lastEvent_);
+        });
+
+        lastEvent_ = parallelFor(getNumberOfItems(), dependencies, [=](sycl::id<1> idx){
+            size_t i = idx[0];
+            resultRawData[i] = expression.evaluateItem(i);
+        });
+
+        expression.forEachOperandTensor([&](const auto& operand){
+            operand.lastEvent_ = lastEvent_;
+        });
     }
 
     template <class T>
@@ -65,20 +111,74 @@ namespace gema{
 
     template <class T>
     TensorParallel<T>::~TensorParallel(){
-        
+        sync();
     }
 
     template <class T>
     TensorParallel<T>& TensorParallel<T>::operator=(const TensorParallel<T>& otherTensor){
+        sync();
+        otherTensor.sync();
         tensor_ = otherTensor.tensor_;
         queue_ = otherTensor.queue_;
+
+        // Like copy constructor, the setting is copied but the mirror is downloaded again when needed
+        setHostMirror(otherTensor.hostMirrorEnabled_);
+        markDataChanged();
         return *this;
     }
 
     template <class T>
     TensorParallel<T>& TensorParallel<T>::operator=(TensorParallel<T>&& otherTensor) noexcept {
+        if(this == &otherTensor) return *this;
+
+        sync();
         tensor_ = std::move(otherTensor.tensor_);
         queue_ = std::move(otherTensor.queue_);
+        lastEvent_ = otherTensor.lastEvent_;
+
+        // Mirror goes with the items it mirrors
+        hostMirrorEnabled_ = otherTensor.hostMirrorEnabled_;
+        hostMirrorValid_ = otherTensor.hostMirrorValid_;
+        hostMirror_ = std::move(otherTensor.hostMirror_);
+        otherTensor.hostMirrorValid_ = false;
+        return *this;
+    }
+
+    template <class T>
+    template <parallel_expression E>
+    TensorParallel<T>& TensorParallel<T>::operator=(const E& expression){
+
+        // Items are computed in place only if shape stays the same, reallocation would invalidate data of this tensor if it
+        // is part of the expression
+        if(!std::ranges::equal(span_view<uint64_t>(getDimensionSizes()), span_view<uint64_t>(expression.getDimensionSizes()))){
+
+            // Temporary has no mirror, this tensor keeps its setting and downloads the new items when needed
+            const bool mirrorEnabled = hostMirrorEnabled_;
+            *this = TensorParallel<T>(expression);
+            setHostMirror(mirrorEnabled);
+            return *this;
+        }
+
+        if(!expression.hasMatchingOperands()){
+            throw std::invalid_argument("Operands of tensor expression have different dimension sizes");
+        }
+
+        T* resultRawData = getData();
+
+        std::vector<sycl::event> dependencies{lastEvent_};
+        expression.forEachOperandTensor([&](const auto& operand){
+            dependencies.push_back(operand.lastEvent_);
+        });
+
+        lastEvent_ = parallelFor(getNumberOfItems(), dependencies, [=](sycl::id<1> idx){
+            size_t i = idx[0];
+            resultRawData[i] = expression.evaluateItem(i);
+        });
+
+        expression.forEachOperandTensor([&](const auto& operand){
+            operand.lastEvent_ = lastEvent_;
+        });
+
         return *this;
     }
 
@@ -104,23 +204,83 @@ namespace gema{
     }
 
     template <class T>
-    sycl::queue* TensorParallel<T>::getQueue(){
+    /*static*/ sycl::queue* TensorParallel<T>::getGlobalQueue(){
+        static sycl::queue* const queue = QueueRegistry::getQueue();
+        return queue;
+    }
+
+    template <class T>
+    sycl::queue* TensorParallel<T>::getQueue() const {
         return queue_;
     }
 
+    template <class T>
+    void TensorParallel<T>::sync() const {
+        lastEvent_.wait();
+    }
+
+    template <class T>
+    void TensorParallel<T>::setHostMirror(const bool enabled){
+
+        hostMirrorEnabled_ = enabled;
+        if(!enabled){
+            hostMirrorValid_ = false;
+            hostMirror_ = LinearContainer<T>();
+        }
+    }
+
+    template <class T>
+    bool TensorParallel<T>::hasHostMirror() const {
+        return hostMirrorEnabled_;
+    }
+
+    template <class T>
+    const LinearContainer<T>& TensorParallel<T>::getHostItems() const {
+        return refreshHostMirror();
+    }
+
+    template <class T>
+    void TensorParallel<T>::markDataChanged(){
+        hostMirrorValid_ = false;
+    }
+
+    template <class T>
+    const LinearContainer<T>& TensorParallel<T>::refreshHostMirror() const {
+
+        if(hostMirrorValid_) return hostMirror_;
+
+        const uint64_t itemCount = getNumberOfItems();
+        hostMirror_.resize(itemCount);
+        TransferUSM::download(*queue_, hostMirror_.data(), getData(), itemCount, lastEvent_);
+
+        // Without mirror the copy is only returned, so it is never treated as up to date
+        hostMirrorValid_ = hostMirrorEnabled_;
+        return hostMirror_;
+    }
+
     template <class T>
     T TensorParallel<T>::getItem(span_view<uint64_t> coordinates){
         //return tensor_.getItem(coordinates);
         const uint64_t index = tensor_.getIndex(coordinates);
+        if(hostMirrorEnabled_){
+            return refreshHostMirror()[index];
+        }
+
+        sync();
         return tensor_.getDataContainer().get(index);
     }
 
     template <class T>
     void TensorParallel<T>::setItem(const T& value, span_view<uint64_t> coordinates){
 
+        sync();
         const uint64_t index = tensor_.getIndex(coordinates);
         tensor_.getDataContainer().set(index, value);
 
+        if(hostMirrorValid_){
+            hostMirror_[index] = value;
+        }
+
         // T* placeToSave = tensor_.getData() + tensor_.getIndex(coordinates);
 
         // queue_->submit([&](sycl::handler& h){
@@ -130,8 +290,95 @@ namespace gema{
         // }).wait();
     }
 
+    template <class T>
+    LinearContainer<T> TensorParallel<T>::getItems(span_view<uint64_t> coordinatesList){
+
+        const uint64_t rank = getNumberOfDimensions();
+        const uint64_t itemCount = (rank == 0) ? 0 : coordinatesList.size() / rank;
+
+        LinearContainer<T> items(itemCount);
+        if(itemCount == 0) return items;
+
+        if(hostMirrorEnabled_){
+
+            const LinearContainer<T>& mirror = refreshHostMirror();
+            for(uint64_t i = 0; i < itemCount; ++i){
+                items[i] = mirror[tensor_.getIndex(span_view<uint64_t>(coordinatesList.data() + i * rank, rank))];
+            }
+            return items;
+        }
+
+        // Indices and items share one staging block, so a failed allocation (std::bad_alloc) leaves nothing behind
+        const uint64_t indicesBytes = (itemCount * sizeof(uint64_t) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+        MemoryPoolUSM& stagingPool = MemoryPoolUSM::getPool(queue_, sycl::usm::alloc::host);
+        std::byte* stagingBlock = static_cast<std::byte*>(stagingPool.allocate(indicesBytes + itemCount * sizeof(T)));
+        uint64_t* indices = reinterpret_cast<uint64_t*>(stagingBlock);
+        T* staged = reinterpret_cast<T*>(stagingBlock + indicesBytes);
+
+        for(uint64_t i = 0; i < itemCount; ++i){
+            indices[i] = tensor_.getIndex(span_view<uint64_t>(coordinatesList.data() + i * rank, rank));
+        }
+
+        const T* data = tensor_.getData();
+
+        lastEvent_ = queue_->submit([&](sycl::handler& h){
+            h.depends_on(lastEvent_);
+            h.parallel_for(itemCount, [=](sycl::id<1> idx){
+                staged[idx] = data[indices[idx]];
+            });
+        });
+        lastEvent_.wait();
+
+        std::copy_n(staged, itemCount, items.data());
+
+        stagingPool.deallocate(stagingBlock);
+
+        return items;
+    }
+
+    template <class T>
+    void TensorParallel<T>::setItems(span_view<uint64_t> coordinatesList, span_view<T> values){
+
+        const uint64_t rank = getNumberOfDimensions();
+        const uint64_t itemCount = (rank == 0) ? 0 : std::min<uint64_t>(coordinatesList.size() / rank, values.size());
+
+        if(itemCount == 0) return;
+
+        // Indices and items share one staging block, so a failed allocation (std::bad_alloc) leaves nothing behind
+        const uint64_t indicesBytes = (itemCount * sizeof(uint64_t) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+        MemoryPoolUSM& stagingPool = MemoryPoolUSM::getPool(queue_, sycl::usm::alloc::host);
+        std::byte* stagingBlock = static_cast<std::byte*>(stagingPool.allocate(indicesBytes + itemCount * sizeof(T)));
+        uint64_t* indices = reinterpret_cast<uint64_t*>(stagingBlock);
+        T* staged = reinterpret_cast<T*>(stagingBlock + indicesBytes);
+
+        for(uint64_t i = 0; i < itemCount; ++i){
+            indices[i] = tensor_.getIndex(span_view<uint64_t>(coordinatesList.data() + i * rank, rank));
+        }
+        std::copy_n(values.data(), itemCount, staged);
+
+        T* data = tensor_.getData();
+
+        lastEvent_ = queue_->submit([&](sycl::handler& h){
+            h.depends_on(lastEvent_);
+            h.parallel_for(itemCount, [=](sycl::id<1> idx){
+                data[indices[idx]] = staged[idx];
+            });
+        });
+
+        // Staging blocks go back to the pool, which requires no kernel to use them
+        lastEvent_.wait();
+
+        // Which one of duplicate coordinates wins on device is unspecified, so the mirror is downloaded again when needed
+        markDataChanged();
+
+        stagingPool.deallocate(stagingBlock);
+    }
+
     template <class T>
     T* TensorParallel<T>::getData(){
+        markDataChanged();
         return tensor_.getData();
     }
 
@@ -142,7 +389,9 @@ namespace gema{
 
     template <class T>
     TensorParallel<T>& TensorParallel<T>::setData(const LinearContainer<T>& tensorItems){
+        sync();
         tensor_.setData(tensorItems.copyToBackend(DataBackend(queue_)));
+        markDataChanged();
         return *this;
     }
 
@@ -210,31 +459,58 @@ namespace gema{
         }
 
         std::string output = "";
-        LinearContainer<T> dataContainer = tensor_.getDataContainer().copyToBackend(MemoryBackend<T>());
 
-        for(uint64_t i = 0; i < itemCount; ++i){
-            output += 
-                std::format("{}{}{}{}", openingBrackets[i], dataContainer[i], closingBrackets[i], (((i + 1) >= itemCount) ? "" : ", "));
+        const auto formatItems = [&](const LinearContainer<T>& dataContainer, const uint64_t firstItem, const uint64_t chunkItemCount){
+            for(uint64_t i = firstItem; i < firstItem + chunkItemCount; ++i){
+                output += 
+                    std::format("{}{}{}{}", openingBrackets[i], dataContainer[i], closingBrackets[i], (((i + 1) >= itemCount) ? "" : ", "));
+            }
+        };
+
+        if(hostMirrorEnabled_){
+            formatItems(refreshHostMirror(), 0, itemCount);
+            return output;
         }
 
+        LinearContainer<T> dataContainer(itemCount);
+
+        // Items are formatted by chunks as they arrive, while the next chunk is being copied
+        TransferUSM::download(*queue_, dataContainer.data(), getData(), itemCount, lastEvent_, 
+        [&](const uint64_t firstItem, const uint64_t chunkItemCount){
+            formatItems(dataContainer, firstItem, chunkItemCount);
+        });
+
         return output; 
     }
 
     template <class T>
     bool TensorParallel<T>::operator==(const TensorParallel<T>& otherTensor) const {
+        sync();
+        otherTensor.sync();
         return tensor_ == otherTensor.tensor_;
     }
 
     template <class T>
     bool TensorParallel<T>::operator!=(const TensorParallel<T>& otherTensor) const {
+        sync();
+        otherTensor.sync();
         return tensor_ != otherTensor.tensor_;
     }
 
     template <class T>
     TensorParallel<T> TensorParallel<T>::transpositionAndReturn(const uint64_t dim1, const uint64_t dim2) const {
 
-        TensorParallel<T> newTensor(*this);
-        newTensor.transposition();
+        if(dim1 == dim2) return TensorParallel<T>(*this);
+
+        LinearContainer<uint64_t> transposedDimensionSizes = getDimensionSizes().copyToBackend(MemoryBackend<uint64_t>());
+        std::swap(transposedDimensionSizes[dim1], transposedDimensionSizes[dim2]);
+
+        TensorParallel<T> newTensor(transposedDimensionSizes, queue_);
+
+        newTensor.lastEvent_ = transposeItems(getData(), newTensor.getData(), span_view<uint64_t>(getDimensionSizes()), 
+            dim1, dim2, {lastEvent_, newTensor.lastEvent_});
+        lastEvent_ = newTensor.lastEvent_;
+
         return newTensor;
 
         //return tensor_.transpositionAndReturn(dim1, dim2);//never use
@@ -295,69 +571,220 @@ namespace gema{
 
         if(dim1 == dim2) return;
 
-        // Copying the dimensionSizes
-        // Change assigment to just construction of correct size
-        const MetadataContainer oldDimensionSizes = tensor_.dimensionSizes_;
-        span_view<uint64_t> oldDimensionSizesView{oldDimensionSizes};
+        const uint64_t itemCount = tensor_.getNumberOfItems();
+
+        // Initializing the new data
+        DataContainer newData(itemCount, DataBackend(queue_));
+
+        lastEvent_ = transposeItems(tensor_.getData(), newData.data(), span_view<uint64_t>(tensor_.dimensionSizes_), 
+            dim1, dim2, {lastEvent_});
 
         // Swapping the dimension sizes
         const uint64_t temporaryDimensionSize1 = tensor_.dimensionSizes_[dim1];
         tensor_.dimensionSizes_[dim1] = tensor_.dimensionSizes_[dim2];
         tensor_.dimensionSizes_[dim2] = temporaryDimensionSize1;
+        tensor_.updateInnerState();
 
-        span_view<uint64_t> newDimensionSizesView{tensor_.dimensionSizes_};
+        // Old data are released by the assignment, so the kernel reading them must be finished
+        sync();
 
-        const uint64_t itemCount = tensor_.updateInnerState();
-        const uint64_t dimensionCount = tensor_.getNumberOfDimensions();
-        
-        // Initializing the new data
-        DataContainer newData(itemCount, DataBackend(queue_));
+        tensor_.getDataContainer() = std::move(newData);
+        markDataChanged();
+    }
 
-        T* oldDataRaw = tensor_.getData();
-        T* newDataRaw = newData.data();
+    template <class T>
+    void TensorParallel<T>::resize(const LinearContainer<uint64_t>& newDimensionSizes){
 
-        //std::cout << "here transposition" << std::endl;
+        const MetadataContainer& oldDimensionSizes = tensor_.getDimensionSizes();
+        const uint64_t dimensionCount = oldDimensionSizes.size();
 
-        uint64_t* coordsBuffer = sycl::malloc_device<uint64_t>(itemCount * dimensionCount, *queue_);
+        // Jumps and limits of the source are of the old rank, number of dimensions is changed by addDimension and
+        // removeDimension
+        if(newDimensionSizes.size() != dimensionCount){
+            throw std::invalid_argument("Resize can not change the number of dimensions");
+        }
 
-        queue_->parallel_for(itemCount, [=](sycl::id<1> idx){
+        // Growing or shrinking only the first dimension appends or cuts whole blocks at the end
+        const bool keepsPrefix = dimensionCount > 0 && 
+            std::equal(oldDimensionSizes.begin() + 1, oldDimensionSizes.end(), newDimensionSizes.begin() + 1);
 
-            size_t i = idx[0];
+        reshapeItems(newDimensionSizes, getDimensionJumps(), oldDimensionSizes.copyToBackend(MemoryBackend<uint64_t>()), 
+            keepsPrefix);
+    }
 
-            uint64_t* coords = coordsBuffer + i * dimensionCount;
-            Tensor<T>::getCoords(i, oldDimensionSizesView, coords);
+    template <class T>
+    void TensorParallel<T>::resize(const uint64_t newDimensionSize, const uint64_t dimensionIndex){
 
-            uint64_t temporaryCoord1 = coords[dim1];
-            coords[dim1] = coords[dim2];
-            coords[dim2] = temporaryCoord1;
+        LinearContainer<uint64_t> newDimensionSizes = tensor_.getDimensionSizes().copyToBackend(MemoryBackend<uint64_t>());
+        newDimensionSizes[dimensionIndex] = newDimensionSize;
+        resize(newDimensionSizes);
+    }
+
+    template <class T>
+    void TensorParallel<T>::addDimension(const uint64_t newDimensionSize, const uint64_t putBefore){
 
-            span_view<uint64_t> coordsView{coords, dimensionCount};
+        LinearContainer<uint64_t> newDimensionSizes = tensor_.getDimensionSizes().copyToBackend(MemoryBackend<uint64_t>());
+        LinearContainer<uint64_t> sourceJumps = getDimensionJumps();
+        LinearContainer<uint64_t> sourceLimits = newDimensionSizes;
 
-            newDataRaw[Tensor<T>::getIndex(coordsView, newDimensionSizesView)] = std::move(oldDataRaw[i]);
+        // Items get coordinate zero in the new dimension
+        newDimensionSizes.insert(newDimensionSizes.begin() + putBefore, newDimensionSize);
+        sourceJumps.insert(sourceJumps.begin() + putBefore, 0);
+        sourceLimits.insert(sourceLimits.begin() + putBefore, 1);
 
-        }).wait();
+        const bool keepsPrefix = putBefore == 0 || newDimensionSize == 1;
 
-        tensor_.getDataContainer() = std::move(newData);
+        reshapeItems(newDimensionSizes, sourceJumps, sourceLimits, keepsPrefix);
     }
 
     template <class T>
-    void TensorParallel<T>::resize(const LinearContainer<uint64_t>& newDimensionSizes){
+    void TensorParallel<T>::removeDimension(const uint64_t removedDimensionIndex){
+
+        LinearContainer<uint64_t> newDimensionSizes = tensor_.getDimensionSizes().copyToBackend(MemoryBackend<uint64_t>());
+        LinearContainer<uint64_t> sourceJumps = getDimensionJumps();
+
+        // Only items with coordinate zero in the removed dimension are kept
+        const bool keepsPrefix = removedDimensionIndex == 0 || newDimensionSizes[removedDimensionIndex] == 1;
 
+        newDimensionSizes.erase(newDimensionSizes.begin() + removedDimensionIndex);
+        sourceJumps.erase(sourceJumps.begin() + removedDimensionIndex);
+
+        reshapeItems(newDimensionSizes, sourceJumps, newDimensionSizes, keepsPrefix);
     }
 
     template <class T>
-    void TensorParallel<T>::resize(const uint64_t newDimensionSize, const uint64_t dimensionIndex){
+    template <apply_callable_parallel<T> C>
+    void TensorParallel<T>::collapseDimension(const uint64_t dimensionIndex, const C& binaryOperation){
 
+        reduceDimension(dimensionIndex, [=](const T* items, const uint64_t count, const uint64_t stride){
+
+            if(count == 0){
+                return T{};
+            }
+
+            T accumulated = items[0];
+            for(uint64_t j = 1; j < count; ++j){
+                binaryOperation(accumulated, items[j * stride]);
+            }
+            return accumulated;
+        });
     }
 
     template <class T>
-    void TensorParallel<T>::addDimension(const uint64_t newDimensionSize, const uint64_t putBefore){
+    template <reduce_callable_parallel<T> C>
+    T TensorParallel<T>::reduce(C&& operation, const T& init) const {
+
+        const uint64_t itemCount = getNumberOfItems();
+        if(itemCount == 0){
+            return init;
+        }
+
+        const T* dataRaw = getData();
+
+        if constexpr (sycl::has_known_identity_v<std::remove_cvref_t<C>, T>){
+
+            const auto reduceInto = [&](T* resultRaw){
+
+                *resultRaw = init;
+
+                // Without initialize_to_identity property the reduction is combined with init
+                queue_->submit([&](sycl::handler& h){
+                    h.depends_on(lastEvent_);
+                    h.parallel_for(sycl::range<1>(itemCount), sycl::reduction(resultRaw, operation), 
+                    [=](sycl::id<1> idx, auto& reducer){
+                        reducer.combine(dataRaw[idx[0]]);
+                    });
+                }).wait();
+
+                return *resultRaw;
+            };
+
+            // Result is a recycled block of the queue's shared pool, so no memory is allocated and concurrent reductions on
+            // the same device do not wait for each other
+            MemoryPoolUSM& pool = MemoryPoolUSM::getPool(queue_, sycl::usm::alloc::shared);
+
+            T* resultRaw = static_cast<T*>(pool.allocate(sizeof(T)));
+            const T result = reduceInto(resultRaw);
+            pool.deallocate(resultRaw);
+            return result;
+
+        }else{
+
+            // Global size never exceeds item count, so every work-item gets at least one item and no identity is needed. Work-items
+            // reduce contiguous parts and results are combined in index order, so the operation does not have to be commutative.
+            constexpr uint64_t maxLocalSize = 256;
+            constexpr uint64_t maxGroupCount = 64;
+
+            const uint64_t localSize = std::bit_floor(std::min(maxLocalSize, itemCount));
+            const uint64_t groupCount = std::clamp<uint64_t>(itemCount / localSize, 1, maxGroupCount);
+            const uint64_t globalSize = localSize * groupCount;
+
+            DataContainer partialResults(groupCount, DataBackend(queue_));
+            T* partialResultsRaw = partialResults.data();
+
+            queue_->submit([&](sycl::handler& h){
+
+                h.depends_on(lastEvent_);
+                sycl::local_accessor<T, 1> localResults(sycl::range<1>(localSize), h);
+
+                h.parallel_for(sycl::nd_range<1>(sycl::range<1>(globalSize), sycl::range<1>(localSize)), 
+                [=](sycl::nd_item<1> item){
 
+                    const uint64_t globalId = item.get_global_id(0);
+                    const uint64_t localId = item.get_local_id(0);
+
+                    // First work-items take one extra item each when item count is not divisible by global size
+                    const uint64_t partItems = itemCount / globalSize;
+                    const uint64_t remainder = itemCount % globalSize;
+                    const uint64_t partBegin = globalId * partItems + std::min(globalId, remainder);
+                    const uint64_t partEnd = partBegin + partItems + (globalId < remainder ? 1 : 0);
+
+                    T accumulated = dataRaw[partBegin];
+                    for(uint64_t i = partBegin + 1; i < partEnd; ++i){
+                        accumulated = operation(accumulated, dataRaw[i]);
+                    }
+
+                    localResults[localId] = accumulated;
+                    sycl::group_barrier(item.get_group());
+
+                    // Neighbouring results are combined first, left one as the first operand
+                    for(uint64_t stride = 1; stride < localSize; stride *= 2){
+
+                        if(localId % (2 * stride) == 0){
+                            localResults[localId] = operation(localResults[localId], localResults[localId + stride]);
+                        }
+                        sycl::group_barrier(item.get_group());
+                    }
+
+                    if(localId == 0){
+                        partialResultsRaw[item.get_group(0)] = localResults[0];
+                    }
+                });
+            }).wait();
+
+            const LinearContainer<T> hostPartialResults = partialResults.copyToBackend(MemoryBackend<T>());
+
+            T result = init;
+            for(uint64_t i = 0; i < hostPartialResults.size(); ++i){
+                result = operation(result, hostPartialResults[i]);
+            }
+
+            return result;
+        }
     }
 
     template <class T>
-    void TensorParallel<T>::removeDimension(const uint64_t removedDimensionIndex){
+    template <reduce_callable_parallel<T> C>
+    void TensorParallel<T>::reduce(const uint64_t dimensionIndex, C&& operation, const T& init){
+
+        reduceDimension(dimensionIndex, [=](const T* items, const uint64_t count, const uint64_t stride){
 
+            T accumulated = init;
+            for(uint64_t j = 0; j < count; ++j){
+                accumulated = operation(accumulated, items[j * stride]);
+            }
+            return accumulated;
+        });
     }
 
     template <class T>
@@ -373,7 +800,6 @@ namespace gema{
 
         using opReturnType = decltype(operation(std::declval<T>(), std::declval<T>()));
         const TensorParallel<T>* tensorOperand = type_pick<TensorParallel<T>>(operand1, operand2);
-        sycl::queue* queue = tensorOperand->queue_;
 
         TensorParallel<opReturnType> resultTensor = TensorParallel<opReturnType>(tensorOperand);
         opReturnType* resultRawData = resultTensor.getData();
@@ -390,7 +816,12 @@ namespace gema{
             operand1Raw = operand1.getData();
         }
 
-        queue->parallel_for(tensorOperand->getNumberOfItems(), [=](sycl::id<1> idx){
+        std::vector<sycl::event> dependencies{resultTensor.lastEvent_, tensorOperand->lastEvent_};
+        if constexpr (std::is_same_v<A, B>){
+            dependencies.push_back(operand2.lastEvent_);
+        }
+
+        resultTensor.lastEvent_ = tensorOperand->parallelFor(tensorOperand->getNumberOfItems(), dependencies, [=](sycl::id<1> idx){
 
             size_t i = idx[0];
             if constexpr (std::is_same_v<A, B>){
@@ -400,55 +831,80 @@ namespace gema{
             }else if constexpr (std::is_same_v<B, T>){
                 resultRawData[i] = operation(operand1Raw[i], operand2);
             }
-        }).wait();
+        });
+
+        tensorOperand->lastEvent_ = resultTensor.lastEvent_;
+        if constexpr (std::is_same_v<A, B>){
+            operand2.lastEvent_ = resultTensor.lastEvent_;
+        }
 
         return resultTensor;
     }
 
     template <class T>
     template <apply_callable_parallel<T> C>
-    void TensorParallel<T>::apply(const TensorParallel<T>& tensor2, C&& operation){
+    void TensorParallel<T>::apply(const TensorParallel<T>& tensor2, C&& operation, const ExecutionPolicy /*policy*/){
         TensorParallel<T>::apply(*this, tensor2, std::forward<C>(operation));
     }
 
+    template <class T>
+    template <parallel_expression E, typename C>
+    void TensorParallel<T>::apply(const E& expression, C&& operation, const ExecutionPolicy /*policy*/){
+
+        T* operand1Raw = getData();
+
+        std::vector<sycl::event> dependencies{lastEvent_};
+        expression.forEachOperandTensor([&](const auto& operand){
+            dependencies.push_back(operand.lastEvent_);
+        });
+
+        lastEvent_ = parallelFor(getNumberOfItems(), dependencies, [=](sycl::id<1> idx){
+            size_t i = idx[0];
+            operation(operand1Raw[i], expression.evaluateItem(i));
+        });
+
+        expression.forEachOperandTensor([&](const auto& operand){
+            operand.lastEvent_ = lastEvent_;
+        });
+    }
+
     template <class T>
     template <apply_callable_parallel<T> C>
     /*static*/ void TensorParallel<T>::apply(TensorParallel<T>& operand1, const TensorParallel<T>& operand2, C&& operation){
 
-        sycl::queue* queue = operand1.queue_;
         T* operand1Raw = operand1.getData();
         const T* operand2Raw = operand2.getData();
 
-        queue->parallel_for(operand1.getNumberOfItems(), [=](sycl::id<1> idx){
+        operand1.lastEvent_ = operand1.parallelFor(operand1.getNumberOfItems(), {operand1.lastEvent_, operand2.lastEvent_}, 
+        [=](sycl::id<1> idx){
             size_t i = idx[0];
             operation(operand1Raw[i], operand2Raw[i]);
-        }).wait();
+        });
+        operand2.lastEvent_ = operand1.lastEvent_;
     }
 
     template <class T>
     template <apply_callable_parallel<T> C>
     /*static*/ void TensorParallel<T>::apply(TensorParallel<T>& operand1, const T& operand2, C&& operation){
 
-        sycl::queue* queue = operand1.queue_;
         T* operand1Raw = operand1.getData();
 
-        queue->parallel_for(operand1.getNumberOfItems(), [=](sycl::id<1> idx){
+        operand1.lastEvent_ = operand1.parallelFor(operand1.getNumberOfItems(), {operand1.lastEvent_}, [=](sycl::id<1> idx){
             size_t i = idx[0];
             operation(operand1Raw[i], operand2);
-        }).wait();
+        });
     }
 
     template <class T>
     template <apply_reverse_callable_parallel<T> C>
     /*static*/ void TensorParallel<T>::apply(const T& operand1, TensorParallel<T>& operand2, C&& operation){
 
-        sycl::queue* queue = operand2.queue_;
         T* operand2Raw = operand2.getData();
 
-        queue->parallel_for(operand2.getNumberOfItems(), [=](sycl::id<1> idx){
+        operand2.lastEvent_ = operand2.parallelFor(operand2.getNumberOfItems(), {operand2.lastEvent_}, [=](sycl::id<1> idx){
             size_t i = idx[0];
             operation(operand1, operand2Raw[i]);
-        }).wait();
+        });
     }
 
     template <class T>
@@ -462,23 +918,24 @@ namespace gema{
     /*static*/ auto TensorParallel<T>::forEachAndReturn(const TensorParallel<T>& tensor, C&& operation){
 
         const T* operandRaw = tensor.getData();
-        sycl::queue* queue = tensor.queue_;
 
         using opReturnType = decltype(operation(std::declval<T>()));
         TensorParallel<opReturnType> resultTensor = TensorParallel<opReturnType>(&tensor);
         opReturnType* resultRawData = resultTensor.getData();
 
-        queue->parallel_for(tensor.getNumberOfItems(), [=](sycl::id<1> idx){
+        resultTensor.lastEvent_ = tensor.parallelFor(tensor.getNumberOfItems(), {resultTensor.lastEvent_, tensor.lastEvent_}, 
+        [=](sycl::id<1> idx){
             size_t i = idx[0];
             resultRawData[i] = operation(operandRaw[i]);
-        }).wait();
+        });
+        tensor.lastEvent_ = resultTensor.lastEvent_;
 
         return resultTensor;
     }
 
     template <class T>
     template <foreach_callable_parallel<T> C>
-    void TensorParallel<T>::forEach(C&& operation){
+    void TensorParallel<T>::forEach(C&& operation, const ExecutionPolicy /*policy*/){
         TensorParallel<T>::forEach(*this, std::forward<C>(operation));
     }
 
@@ -486,25 +943,389 @@ namespace gema{
     template <foreach_callable_parallel<T> C>
     /*static*/ void TensorParallel<T>::forEach(TensorParallel<T>& tensor, C&& operation){
 
-        sycl::queue* queue = tensor.queue_;
         T* operandRaw = tensor.getData();
 
-        queue->parallel_for(tensor.getNumberOfItems(), [=](sycl::id<1> idx){
+        tensor.lastEvent_ = tensor.parallelFor(tensor.getNumberOfItems(), {tensor.lastEvent_}, [=](sycl::id<1> idx){
             size_t i = idx[0];
             operation(operandRaw[i]);
-        }).wait();
+        });
+    }
+
+    template <class T>
+    template <foreach_coord_callable_parallel<T> C>
+    bool TensorParallel<T>::forEachWithCoords(C&& operation){
+
+        LinearContainer<uint64_t> boxBegin(getNumberOfDimensions());
+        std::fill(boxBegin.begin(), boxBegin.end(), 0);
+
+        return forEachWithCoords(std::forward<C>(operation), span_view<uint64_t>(boxBegin),
+            span_view<uint64_t>(getDimensionSizes()));
+    }
+
+    template <class T>
+    template <foreach_coord_callable_parallel<T> C>
+    bool TensorParallel<T>::forEachWithCoords(C&& operation, span_view<uint64_t> boxBegin, span_view<uint64_t> boxEnd){
+
+        const uint64_t dimensionCount = getNumberOfDimensions();
+
+        if(!Tensor<T>::isValidBox(boxBegin, boxEnd, span_view<uint64_t>(getDimensionSizes()))) return false;
+
+        uint64_t boxItemCount = 1;
+        for(uint64_t d = 0; d < dimensionCount; ++d){
+            boxItemCount *= boxEnd[d] - boxBegin[d];
+        }
+
+        // Tensor without dimensions has one item, its single work-item decodes empty coordinates
+        if(boxItemCount == 0) return true;
+
+        if(dimensionCount > maxKernelDimensions_){
+            forEachWithCoordsShared(operation, boxBegin, boxEnd, boxItemCount);
+            return true;
+        }
+
+        // Box is captured by value, so the kernel needs no allocation for it
+        const LinearContainer<uint64_t> dimensionJumps = getDimensionJumps();
+        std::array<uint64_t, maxKernelDimensions_> begins{};
+        std::array<uint64_t, maxKernelDimensions_> sizes{};
+        std::array<uint64_t, maxKernelDimensions_> jumps{};
+
+        for(uint64_t d = 0; d < dimensionCount; ++d){
+            begins[d] = boxBegin[d];
+            sizes[d] = boxEnd[d] - boxBegin[d];
+            jumps[d] = dimensionJumps[d];
+        }
+
+        T* dataRaw = getData();
+
+        lastEvent_ = parallelFor(boxItemCount, {lastEvent_}, [=](sycl::id<1> idx){
+
+            uint64_t coordinates[maxKernelDimensions_];
+            uint64_t rest = idx[0];
+            uint64_t itemIndex = 0;
+
+            for(uint64_t d = dimensionCount; d-- > 0;){
+                coordinates[d] = begins[d] + rest % sizes[d];
+                rest /= sizes[d];
+                itemIndex += coordinates[d] * jumps[d];
+            }
+
+            operation(dataRaw[itemIndex], span_view<uint64_t>(coordinates, dimensionCount));
+        });
+
+        return true;
+    }
+
+    template <class T>
+    template <typename C>
+    void TensorParallel<T>::forEachWithCoordsShared(C&& operation, span_view<uint64_t> boxBegin, span_view<uint64_t> boxEnd,
+    const uint64_t boxItemCount){
+
+        const uint64_t dimensionCount = getNumberOfDimensions();
+        const uint64_t workItemCount = std::min(boxItemCount, maxCoordsWorkItems_);
+        const uint64_t chunkItems = (boxItemCount + workItemCount - 1) / workItemCount;
+
+        // Box begins, box sizes and jumps, then coordinates of every work-item, all in one shared allocation
+        const LinearContainer<uint64_t> dimensionJumps = getDimensionJumps();
+        LinearContainer<uint64_t, MetadataBackend> layout((3 + workItemCount) * dimensionCount, MetadataBackend(queue_));
+        for(uint64_t d = 0; d < dimensionCount; ++d){
+            layout[d] = boxBegin[d];
+            layout[dimensionCount + d] = boxEnd[d] - boxBegin[d];
+            layout[2 * dimensionCount + d] = dimensionJumps[d];
+        }
+
+        uint64_t* layoutRaw = layout.data();
+        T* dataRaw = getData();
+
+        lastEvent_ = parallelFor(workItemCount, {lastEvent_}, [=](sycl::id<1> idx){
+
+            const uint64_t* begins = layoutRaw;
+            const uint64_t* sizes = layoutRaw + dimensionCount;
+            const uint64_t* jumps = layoutRaw + 2 * dimensionCount;
+            uint64_t* coordinates = layoutRaw + (3 + idx[0]) * dimensionCount;
+
+            const uint64_t begin = idx[0] * chunkItems;
+            const uint64_t end = begin + chunkItems < boxItemCount ? begin + chunkItems : boxItemCount;
+            if(begin >= end) return;
+
+            // Only the first item of the chunk is decoded from its index
+            uint64_t rest = begin;
+            uint64_t itemIndex = 0;
+            for(uint64_t d = dimensionCount; d-- > 0;){
+                coordinates[d] = begins[d] + rest % sizes[d];
+                rest /= sizes[d];
+                itemIndex += coordinates[d] * jumps[d];
+            }
+
+            for(uint64_t i = begin; i < end; ++i){
+
+                operation(dataRaw[itemIndex], span_view<uint64_t>(coordinates, dimensionCount));
+
+                // Odometer, the same as in Tensor::forEachWithCoords
+                uint64_t d = dimensionCount - 1;
+                ++coordinates[d];
+                itemIndex += jumps[d];
+
+                while(coordinates[d] == begins[d] + sizes[d] && d > 0){
+                    coordinates[d] = begins[d];
+                    itemIndex -= sizes[d] * jumps[d];
+                    --d;
+                    ++coordinates[d];
+                    itemIndex += jumps[d];
+                }
+            }
+        });
+
+        // Layout is released at the end of this scope
+        sync();
+    }
+
+    template <class T>
+    template <typename K>
+    sycl::event TensorParallel<T>::parallelFor(const uint64_t itemCount, const std::vector<sycl::event>& dependencies, K&& kernel) const {
+        return queue_->submit([&](sycl::handler& h){
+            h.depends_on(dependencies);
+            h.parallel_for(sycl::range<1>(itemCount), kernel);
+        });
+    }
+
+    template <class T>
+    template <tensor_expression E>
+    /*static*/ sycl::queue* TensorParallel<T>::getExpressionQueue(const E& expression){
+
+        sycl::queue* queue = nullptr;
+        expression.forEachOperandTensor([&](const auto& operand){
+            if(queue == nullptr) queue = operand.queue_;
+        });
+        return queue != nullptr ? queue : getGlobalQueue();
+    }
+
+    template <class T>
+    template <typename F>
+    void TensorParallel<T>::reduceDimension(const uint64_t dimensionIndex, F&& reduceItems){
+
+        const MetadataContainer& dimensionSizes = getDimensionSizes();
+
+        // Items are viewed as [outer][reduced][inner] block
+        LinearContainer<uint64_t> newDimensionSizes;
+        uint64_t outerCount = 1;
+        uint64_t innerCount = 1;
+
+        for(uint64_t i = 0; i < dimensionSizes.size(); ++i){
+            if(i < dimensionIndex) outerCount *= dimensionSizes[i];
+            if(i > dimensionIndex) innerCount *= dimensionSizes[i];
+            if(i != dimensionIndex) newDimensionSizes.push_back(dimensionSizes[i]);
+        }
+
+        const uint64_t reducedSize = dimensionSizes[dimensionIndex];
+
+        TensorParallel<T> reducedTensor(newDimensionSizes, queue_);
+
+        const T* dataRaw = getData();
+        T* reducedDataRaw = reducedTensor.getData();
+
+        // Neighboring work-items read neighboring inner items
+        reducedTensor.lastEvent_ = parallelFor(outerCount * innerCount, {lastEvent_}, [=](sycl::id<1> idx){
+
+            const uint64_t i = idx[0];
+            const uint64_t outer = i / innerCount;
+            const uint64_t inner = i - outer * innerCount;
+
+            reducedDataRaw[i] = reduceItems(dataRaw + outer * reducedSize * innerCount + inner, reducedSize, innerCount);
+        });
+
+        // Old data must not be released before the kernel reading them finishes. Mirror setting stays, items of the reduced
+        // tensor are downloaded when needed.
+        const bool mirrorEnabled = hostMirrorEnabled_;
+        lastEvent_ = reducedTensor.lastEvent_;
+        *this = std::move(reducedTensor);
+        setHostMirror(mirrorEnabled);
     }
 
     template <class T>
     template <apply_to_item_callable<T> C>
     void TensorParallel<T>::applyToItem(span_view<uint64_t> coords, C&& operation){
 
-        T* operationItem = tensor_.getData() + tensor_.getIndex(coords);
+        T* operationItem = getData() + tensor_.getIndex(coords);
 
-        queue_->submit([&](sycl::handler& h){
+        lastEvent_ = queue_->submit([&](sycl::handler& h){
+            h.depends_on(lastEvent_);
             h.single_task([=](){
                 operation(*operationItem);
             });
-        }).wait();
+        });
+    }
+    template <class T>
+    void TensorParallel<T>::uploadItems(const LinearContainer<T>& items){
+
+        // Like Tensor, surplus items are discarded and missing ones keep their default value
+        const uint64_t itemCount = std::min<uint64_t>(items.size(), getNumberOfItems());
+        lastEvent_ = TransferUSM::upload(*queue_, getData(), items.data(), itemCount, lastEvent_);
+    }
+
+    template <class T>
+    void TensorParallel<T>::reshapeItems(
+        const LinearContainer<uint64_t>& newDimensionSizes, 
+        const LinearContainer<uint64_t>& sourceJumps, 
+        const LinearContainer<uint64_t>& sourceLimits, 
+        const bool keepsPrefix
+    ){
+
+        markDataChanged();
+
+        if(keepsPrefix){
+
+            // Container keeps its capacity, when growing only the new items are constructed on device
+            sync();
+            tensor_.dimensionSizes_.assign(newDimensionSizes.begin(), newDimensionSizes.end());
+            tensor_.getDataContainer().resize(tensor_.updateInnerState());
+            return;
+        }
+
+        const uint64_t dimensionCount = newDimensionSizes.size();
+
+        // Dimension sizes, source jumps and source limits in one shared allocation readable by the kernel
+        LinearContainer<uint64_t, MetadataBackend> layout(3 * dimensionCount, MetadataBackend(queue_));
+        for(uint64_t d = 0; d < dimensionCount; ++d){
+            layout[d] = newDimensionSizes[d];
+            layout[dimensionCount + d] = sourceJumps[d];
+            layout[2 * dimensionCount + d] = sourceLimits[d];
+        }
+
+        Tensor<T, DataBackend, MetadataBackend> newTensor(MetadataContainer(newDimensionSizes, MetadataBackend(queue_)), 
+            DataBackend(queue_));
+
+        const uint64_t* layoutRaw = layout.data();
+        const T* oldDataRaw = getData();
+        T* newDataRaw = newTensor.getData();
+
+        lastEvent_ = parallelFor(newTensor.getNumberOfItems(), {lastEvent_}, [=](sycl::id<1> idx){
+
+            uint64_t rest = idx[0];
+            uint64_t sourceIndex = 0;
+            bool inSource = true;
+
+            for(uint64_t d = dimensionCount; d-- > 0;){
+
+                const uint64_t coordinate = rest % layoutRaw[d];
+                rest /= layoutRaw[d];
+
+                inSource = inSource && coordinate < layoutRaw[2 * dimensionCount + d];
+                sourceIndex += coordinate * layoutRaw[dimensionCount + d];
+            }
+
+            newDataRaw[idx[0]] = inSource ? oldDataRaw[sourceIndex] : T{};
+        });
+
+        // Old data and layout are released at the end of this scope
+        sync();
+
+        tensor_ = std::move(newTensor);
+    }
+
+    template <class T>
+    sycl::event TensorParallel<T>::transposeItems(const T* source, T* destination, span_view<uint64_t> dimensionSizes, 
+    uint64_t dim1, uint64_t dim2, const std::vector<sycl::event>& dependencies) const {
+
+        if(dim1 > dim2) std::swap(dim1, dim2);
+
+        uint64_t outerCount = 1;
+        uint64_t middleCount = 1;
+        uint64_t innerCount = 1;
+
+        for(uint64_t d = 0; d < dimensionSizes.size(); ++d){
+            if(d < dim1) outerCount *= dimensionSizes[d];
+            if(d > dim1 && d < dim2) middleCount *= dimensionSizes[d];
+            if(d > dim2) innerCount *= dimensionSizes[d];
+        }
+
+        const uint64_t size1 = dimensionSizes[dim1];
+        const uint64_t size2 = dimensionSizes[dim2];
+
+        // Inner blocks are moved as they are, their consecutive items stay consecutive, so accesses are already coalesced
+        if(innerCount > 1){
+
+            return parallelFor(outerCount * size1 * middleCount * size2 * innerCount, dependencies, [=](sycl::id<1> idx){
+
+                uint64_t rest = idx[0];
+                const uint64_t inner = rest % innerCount;
+                rest /= innerCount;
+                const uint64_t index2 = rest % size2;
+                rest /= size2;
+                const uint64_t middle = rest % middleCount;
+                rest /= middleCount;
+                const uint64_t index1 = rest % size1;
+                const uint64_t outer = rest / size1;
+
+                destination[(((outer * size2 + index2) * middleCount + middle) * size1 + index1) * innerCount + inner] = 
+                    source[idx[0]];
+            });
+        }
+
+        const uint64_t maxWorkGroupSize = queue_->get_device().template get_info<sycl::info::device::max_work_group_size>();
+
+        uint64_t tileSide = transposeTileSide_;
+        while(tileSide > 1 && tileSide * tileSide > maxWorkGroupSize){
+            tileSide /= 2;
+        }
+
+        // One padding column, so work-items reading a column of the tile hit different local memory banks
+        const uint64_t tileStride = tileSide + 1;
+        const uint64_t tiles1 = (size1 + tileSide - 1) / tileSide;
+        const uint64_t tiles2 = (size2 + tileSide - 1) / tileSide;
+
+        return queue_->submit([&](sycl::handler& h){
+
+            h.depends_on(dependencies);
+
+            sycl::local_accessor<T, 1> tile(sycl::range<1>(tileSide * tileStride), h);
+
+            h.parallel_for(sycl::nd_range<3>(
+                sycl::range<3>(outerCount * middleCount, tiles1 * tileSide, tiles2 * tileSide),
+                sycl::range<3>(1, tileSide, tileSide)
+            ), [=](sycl::nd_item<3> item){
+
+                const uint64_t outer = item.get_global_id(0) / middleCount;
+                const uint64_t middle = item.get_global_id(0) % middleCount;
+                const uint64_t row = item.get_local_id(1);
+                const uint64_t column = item.get_local_id(2);
+                const uint64_t tileStart1 = item.get_group(1) * tileSide;
+                const uint64_t tileStart2 = item.get_group(2) * tileSide;
+
+                // Neighbouring work-items read neighbouring items of dim2, which is the contiguous one in source
+                const uint64_t sourceIndex1 = tileStart1 + row;
+                const uint64_t sourceIndex2 = tileStart2 + column;
+
+                if(sourceIndex1 < size1 && sourceIndex2 < size2){
+                    tile[row * tileStride + column] = 
+                        source[((outer * size1 + sourceIndex1) * middleCount + middle) * size2 + sourceIndex2];
+                }
+
+                sycl::group_barrier(item.get_group());
+
+                // And write neighbouring items of dim1, which is the contiguous one in destination
+                const uint64_t destinationIndex1 = tileStart1 + column;
+                const uint64_t destinationIndex2 = tileStart2 + row;
+
+                if(destinationIndex1 < size1 && destinationIndex2 < size2){
+                    destination[((outer * size2 + destinationIndex2) * middleCount + middle) * size1 + destinationIndex1] = 
+                        tile[column * tileStride + row];
+                }
+            });
+        });
+    }
+
+    template <class T>
+    LinearContainer<uint64_t> TensorParallel<T>::getDimensionJumps() const {
+
+        const MetadataContainer& dimensionSizes = tensor_.getDimensionSizes();
+        LinearContainer<uint64_t> dimensionJumps(dimensionSizes.size());
+
+        uint64_t jump = 1;
+        for(uint64_t d = dimensionSizes.size(); d-- > 0;){
+            dimensionJumps[d] = jump;
+            jump *= dimensionSizes[d];
+        }
+
+        return dimensionJumps;
     }
 }
\ No newline at end of file
@@ -0,0 +1,207 @@
+#ifndef TENSOR_SHARDED_HPP
+#define TENSOR_SHARDED_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <sycl/sycl.hpp>
+
+#include "LinearContainer.hpp"
+#include "Tensor.hpp"
+#include "TensorParallel.hpp"
+
+namespace gema{
+
+/**
+ * @brief Tensor split along its first dimension into shards, each of them is TensorParallel living on its own queue. Queues
+ * may belong to different devices, to sub-devices of one device or be several queues of the same device, so for example
+ * several host queues split the work on OpenMP target. Shard s holds indices [s * size / n, (s + 1) * size / n) of the
+ * first dimension, where n is the number of queues. Tensor without dimensions is not split, its single item is in one shard
+ * on the first queue.
+ *
+ * @par
+ * Elementwise operations are submitted to all shards without waiting, so they run on all queues at once. Operations that
+ * need items of other shards (reductions over all items or over the first dimension, transpositions with the first
+ * dimension) go through explicit exchange, that gathers the shards into one TensorParallel and scatters the result back.
+ *
+ * @par
+ * Queues are not owned, they must outlive the tensor. Tensors taking part in one operation must have the same dimension
+ * sizes and the same queues.
+ *
+ * @tparam T type of items.
+ */
+template<class T>
+class TensorSharded {
+
+    std::vector<sycl::queue*> queues_;
+    LinearContainer<uint64_t> dimensionSizes_;
+    // Index of the first dimension where every shard begins, the last value is the size of the first dimension or 1 if there
+    // are no dimensions
+    std::vector<uint64_t> shardBegins_;
+    std::vector<TensorParallel<T>> shards_;
+
+    template <typename U>
+    friend class TensorSharded;
+
+    TensorSharded(const LinearContainer<uint64_t>& dimensionSizes, const std::vector<sycl::queue*>& queues,
+    std::vector<TensorParallel<T>>&& shards);
+
+    // Throws std::invalid_argument without queues
+    static std::vector<uint64_t> getShardBegins(const LinearContainer<uint64_t>& dimensionSizes, const uint64_t queueCount);
+
+    LinearContainer<uint64_t> getShardDimensionSizes(const uint64_t shard) const;
+
+    // Items of one index of the first dimension
+    uint64_t getSliceItemCount() const;
+
+    // Index of shard holding given index of the first dimension
+    uint64_t findShard(const uint64_t leadingIndex) const;
+
+    // Converts coordinates of the whole tensor to coordinates inside of their shard
+    LinearContainer<uint64_t> getShardCoordinates(span_view<uint64_t> coordinates, const uint64_t shard) const;
+
+    // Copies items between memory of two queues after dependency, directly if the queues share context, otherwise through
+    // host memory. Returns event of the copy, that is already finished in the second case.
+    static sycl::event copyBetweenQueues(T* destination, sycl::queue* destinationQueue, const T* source, 
+    sycl::queue* sourceQueue, const uint64_t itemCount, const sycl::event& dependency);
+
+    public:
+
+    using value_type = T;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Creates tensor of given dimension sizes split among queues.
+     *
+     * @param newDimensionSizes dimension sizes.
+     * @param queues queues of the shards, throws std::invalid_argument if there is none.
+     */
+    TensorSharded(const LinearContainer<uint64_t>& newDimensionSizes, const std::vector<sycl::queue*>& queues);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Creates tensor of given dimension sizes split among queues, every shard gets its part of items.
+     *
+     * @param newDimensionSizes dimension sizes.
+     * @param newData items of the whole tensor in host memory.
+     * @param queues queues of the shards, throws std::invalid_argument if there is none.
+     */
+    TensorSharded(const LinearContainer<uint64_t>& newDimensionSizes, const LinearContainer<T>& newData,
+    const std::vector<sycl::queue*>& queues);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Splits tensor among queues. Shards on queues of the same context as the tensor are copied directly, others
+     * through host memory.
+     *
+     * @param tensor tensor to split.
+     * @param queues queues of the shards, there must be at least one queue.
+     *
+     * @return Sharded tensor with the same items.
+     */
+    static TensorSharded<T> scatter(const TensorParallel<T>& tensor, const std::vector<sycl::queue*>& queues);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Joins all shards into one tensor on given queue. Shards on queues of the same context are copied directly,
+     * others through host memory.
+     *
+     * @param queue queue of the resulting tensor, it must outlive the tensor.
+     *
+     * @return Tensor with all items.
+     */
+    TensorParallel<T> gather(sycl::queue* queue) const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Copies items of all shards into one tensor in host memory.
+     *
+     * @return Tensor with all items.
+     */
+    Tensor<T> gatherToHost() const;
+
+
+
+    uint64_t getShardCount() const;
+
+    TensorParallel<T>& getShard(const uint64_t shard);
+    const TensorParallel<T>& getShard(const uint64_t shard) const;
+
+    // Index of the first dimension where the shard begins
+    uint64_t getShardBegin(const uint64_t shard) const;
+
+    const std::vector<sycl::queue*>& getQueues() const;
+
+    const LinearContainer<uint64_t>& getDimensionSizes() const;
+
+    uint64_t getNumberOfDimensions() const;
+
+    uint64_t getNumberOfItems() const;
+
+    // Waits until all submitted kernels of all shards are finished
+    void sync() const;
+
+
+
+    T getItem(span_view<uint64_t> coordinates);
+
+    void setItem(const T& value, span_view<uint64_t> coordinates);
+
+    void fillWith(const T& fill);
+
+    std::string toString() const;
+
+    bool operator==(const TensorSharded<T>& otherTensor) const;
+
+    bool operator!=(const TensorSharded<T>& otherTensor) const;
+
+
+
+    // Transposition of other than the first dimension is done by every shard alone, the first dimension needs exchange
+    TensorSharded<T> transpositionAndReturn(const uint64_t dim1 = 0, const uint64_t dim2 = 1) const;
+
+    void transposition(const uint64_t dim1 = 0, const uint64_t dim2 = 1);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Reduces all items. Standard operations with known identity reduce all shards at once and partial results are
+     * combined with init on host, other operations reduce shard after shard, each one starting from result of the previous.
+     *
+     * @param operation associative binary operation.
+     * @param init value combined once with all items.
+     *
+     * @return Reduced value.
+     */
+    template <reduce_callable_parallel<T> C>
+    T reduce(C&& operation, const T& init) const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Reduces one dimension. Other than the first dimension is reduced by every shard alone. The first dimension
+     * is reduced after exchange and the result is split along its new first dimension, so the tensor must have at least
+     * two dimensions then.
+     *
+     * @param dimensionIndex index of reduced dimension.
+     * @param operation associative binary operation.
+     * @param init value combined once with items of every reduced line.
+     */
+    template <reduce_callable_parallel<T> C>
+    void reduce(const uint64_t dimensionIndex, C&& operation, const T& init);
+
+
+
+    template <apply_and_return_callable_parallel<T> C>
+    auto applyAndReturn(const TensorSharded<T>& tensor2, C&& operation) const;
+
+    template <apply_callable_parallel<T> C>
+    void apply(const TensorSharded<T>& tensor2, C&& operation);
+
+    template <apply_callable_parallel<T> C>
+    void apply(const T& operand2, C&& operation);
+
+    template <foreach_and_return_callable_parallel<T> C>
+    auto forEachAndReturn(C&& operation) const;
+
+    template <foreach_callable_parallel<T> C>
+    void forEach(C&& operation);
+};
+
+}
+
+#include "TensorSharded.tpp"
+
+#endif
@@ -0,0 +1,397 @@
+#include <algorithm>
+#include <future>
+#include <stdexcept>
+
+#include "TensorSharded.hpp"
+
+namespace gema{
+
+    template <class T>
+    TensorSharded<T>::TensorSharded(const LinearContainer<uint64_t>& newDimensionSizes, const std::vector<sycl::queue*>& queues)
+    : queues_(queues), dimensionSizes_(newDimensionSizes), shardBegins_(getShardBegins(newDimensionSizes, queues.size())){
+
+        const uint64_t shardCount = shardBegins_.size() - 1;
+        shards_.reserve(shardCount);
+        for(uint64_t s = 0; s < shardCount; ++s){
+            shards_.emplace_back(getShardDimensionSizes(s), queues_[s]);
+        }
+    }
+
+    template <class T>
+    TensorSharded<T>::TensorSharded(const LinearContainer<uint64_t>& newDimensionSizes, const LinearContainer<T>& newData,
+    const std::vector<sycl::queue*>& queues)
+    : TensorSharded(newDimensionSizes, queues){
+
+        const uint64_t sliceItemCount = getSliceItemCount();
+
+        // All copies run at once, but the host data must not be left before they finish
+        std::vector<sycl::event> copies;
+        for(uint64_t s = 0; s < shards_.size(); ++s){
+            copies.push_back(queues_[s]->memcpy(shards_[s].getData(), newData.data() + shardBegins_[s] * sliceItemCount,
+                shards_[s].getNumberOfItems() * sizeof(T)));
+        }
+        sycl::event::wait(copies);
+    }
+
+    template <class T>
+    TensorSharded<T>::TensorSharded(const LinearContainer<uint64_t>& dimensionSizes, const std::vector<sycl::queue*>& queues,
+    std::vector<TensorParallel<T>>&& shards)
+    : queues_(queues), dimensionSizes_(dimensionSizes), shardBegins_(getShardBegins(dimensionSizes, queues.size())),
+    shards_(std::move(shards)){
+
+    }
+
+    template <class T>
+    /*static*/ TensorSharded<T> TensorSharded<T>::scatter(const TensorParallel<T>& tensor, const std::vector<sycl::queue*>& queues){
+
+        TensorSharded<T> shardedTensor(tensor.getDimensionSizes().copyToBackend(MemoryBackend<uint64_t>()), queues);
+        const uint64_t sliceItemCount = shardedTensor.getSliceItemCount();
+
+        std::vector<sycl::event> copies;
+        for(uint64_t s = 0; s < shardedTensor.shards_.size(); ++s){
+
+            TensorParallel<T>& shard = shardedTensor.shards_[s];
+            copies.push_back(copyBetweenQueues(shard.getData(), queues[s],
+                tensor.getData() + shardedTensor.shardBegins_[s] * sliceItemCount, tensor.queue_, shard.getNumberOfItems(),
+                tensor.lastEvent_));
+        }
+        sycl::event::wait(copies);
+
+        return shardedTensor;
+    }
+
+    template <class T>
+    TensorParallel<T> TensorSharded<T>::gather(sycl::queue* queue) const {
+
+        TensorParallel<T> tensor(dimensionSizes_, queue);
+        const uint64_t sliceItemCount = getSliceItemCount();
+
+        std::vector<sycl::event> copies;
+        for(uint64_t s = 0; s < shards_.size(); ++s){
+
+            const TensorParallel<T>& shard = shards_[s];
+            copies.push_back(copyBetweenQueues(tensor.getData() + shardBegins_[s] * sliceItemCount, queue, shard.getData(),
+                queues_[s], shard.getNumberOfItems(), shard.lastEvent_));
+        }
+        sycl::event::wait(copies);
+
+        return tensor;
+    }
+
+    template <class T>
+    Tensor<T> TensorSharded<T>::gatherToHost() const {
+
+        Tensor<T> tensor(dimensionSizes_);
+        const uint64_t sliceItemCount = getSliceItemCount();
+
+        std::vector<sycl::event> copies;
+        for(uint64_t s = 0; s < shards_.size(); ++s){
+            copies.push_back(queues_[s]->memcpy(tensor.getData() + shardBegins_[s] * sliceItemCount, shards_[s].getData(),
+                shards_[s].getNumberOfItems() * sizeof(T), shards_[s].lastEvent_));
+        }
+        sycl::event::wait(copies);
+
+        return tensor;
+    }
+
+    template <class T>
+    uint64_t TensorSharded<T>::getShardCount() const {
+        return shards_.size();
+    }
+
+    template <class T>
+    TensorParallel<T>& TensorSharded<T>::getShard(const uint64_t shard){
+        return shards_[shard];
+    }
+
+    template <class T>
+    const TensorParallel<T>& TensorSharded<T>::getShard(const uint64_t shard) const {
+        return shards_[shard];
+    }
+
+    template <class T>
+    uint64_t TensorSharded<T>::getShardBegin(const uint64_t shard) const {
+        return shardBegins_[shard];
+    }
+
+    template <class T>
+    const std::vector<sycl::queue*>& TensorSharded<T>::getQueues() const {
+        return queues_;
+    }
+
+    template <class T>
+    const LinearContainer<uint64_t>& TensorSharded<T>::getDimensionSizes() const {
+        return dimensionSizes_;
+    }
+
+    template <class T>
+    uint64_t TensorSharded<T>::getNumberOfDimensions() const {
+        return dimensionSizes_.size();
+    }
+
+    template <class T>
+    uint64_t TensorSharded<T>::getNumberOfItems() const {
+        return shardBegins_.back() * getSliceItemCount();
+    }
+
+    template <class T>
+    void TensorSharded<T>::sync() const {
+        for(const TensorParallel<T>& shard : shards_){
+            shard.sync();
+        }
+    }
+
+    template <class T>
+    T TensorSharded<T>::getItem(span_view<uint64_t> coordinates){
+        const uint64_t shard = coordinates.size() > 0 ? findShard(coordinates[0]) : 0;
+        return shards_[shard].getItem(span_view<uint64_t>(getShardCoordinates(coordinates, shard)));
+    }
+
+    template <class T>
+    void TensorSharded<T>::setItem(const T& value, span_view<uint64_t> coordinates){
+        const uint64_t shard = coordinates.size() > 0 ? findShard(coordinates[0]) : 0;
+        shards_[shard].setItem(value, span_view<uint64_t>(getShardCoordinates(coordinates, shard)));
+    }
+
+    template <class T>
+    void TensorSharded<T>::fillWith(const T& fill){
+        for(TensorParallel<T>& shard : shards_){
+            shard.fillWith(fill);
+        }
+    }
+
+    template <class T>
+    std::string TensorSharded<T>::toString() const {
+        return gather(queues_[0]).toString();
+    }
+
+    template <class T>
+    bool TensorSharded<T>::operator==(const TensorSharded<T>& otherTensor) const {
+        return dimensionSizes_ == otherTensor.dimensionSizes_ && gatherToHost() == otherTensor.gatherToHost();
+    }
+
+    template <class T>
+    bool TensorSharded<T>::operator!=(const TensorSharded<T>& otherTensor) const {
+        return !(*this == otherTensor);
+    }
+
+    template <class T>
+    TensorSharded<T> TensorSharded<T>::transpositionAndReturn(const uint64_t dim1, const uint64_t dim2) const {
+
+        if(dim1 == 0 || dim2 == 0){
+            return scatter(gather(queues_[0]).transpositionAndReturn(dim1, dim2), queues_);
+        }
+
+        std::vector<TensorParallel<T>> transposedShards;
+        transposedShards.reserve(shards_.size());
+        for(const TensorParallel<T>& shard : shards_){
+            transposedShards.push_back(shard.transpositionAndReturn(dim1, dim2));
+        }
+
+        LinearContainer<uint64_t> transposedDimensionSizes = dimensionSizes_;
+        std::swap(transposedDimensionSizes[dim1], transposedDimensionSizes[dim2]);
+
+        return TensorSharded<T>(transposedDimensionSizes, queues_, std::move(transposedShards));
+    }
+
+    template <class T>
+    void TensorSharded<T>::transposition(const uint64_t dim1, const uint64_t dim2){
+
+        if(dim1 == 0 || dim2 == 0){
+            *this = transpositionAndReturn(dim1, dim2);
+            return;
+        }
+
+        for(TensorParallel<T>& shard : shards_){
+            shard.transposition(dim1, dim2);
+        }
+        std::swap(dimensionSizes_[dim1], dimensionSizes_[dim2]);
+    }
+
+    template <class T>
+    template <reduce_callable_parallel<T> C>
+    T TensorSharded<T>::reduce(C&& operation, const T& init) const {
+
+        if constexpr (sycl::has_known_identity_v<std::remove_cvref_t<C>, T>){
+
+            const T identity = sycl::known_identity_v<std::remove_cvref_t<C>, T>;
+
+            // Every reduction waits for its queue, so each one is waited for by its own thread
+            std::vector<std::future<T>> partialResults;
+            for(const TensorParallel<T>& shard : shards_){
+                partialResults.push_back(std::async(std::launch::async, [&shard, &operation, identity](){
+                    return shard.reduce(operation, identity);
+                }));
+            }
+
+            T result = init;
+            for(std::future<T>& partialResult : partialResults){
+                result = operation(result, partialResult.get());
+            }
+            return result;
+
+        }else{
+
+            T result = init;
+            for(const TensorParallel<T>& shard : shards_){
+                result = shard.reduce(operation, result);
+            }
+            return result;
+        }
+    }
+
+    template <class T>
+    template <reduce_callable_parallel<T> C>
+    void TensorSharded<T>::reduce(const uint64_t dimensionIndex, C&& operation, const T& init){
+
+        if(dimensionIndex == 0){
+
+            TensorParallel<T> tensor = gather(queues_[0]);
+            tensor.reduce(0, std::forward<C>(operation), init);
+            *this = scatter(tensor, queues_);
+            return;
+        }
+
+        for(TensorParallel<T>& shard : shards_){
+            shard.reduce(dimensionIndex, operation, init);
+        }
+        dimensionSizes_.erase(dimensionSizes_.begin() + dimensionIndex);
+    }
+
+    template <class T>
+    template <apply_and_return_callable_parallel<T> C>
+    auto TensorSharded<T>::applyAndReturn(const TensorSharded<T>& tensor2, C&& operation) const {
+
+        using opReturnType = decltype(operation(std::declval<T>(), std::declval<T>()));
+
+        std::vector<TensorParallel<opReturnType>> resultShards;
+        resultShards.reserve(shards_.size());
+        for(uint64_t s = 0; s < shards_.size(); ++s){
+            resultShards.push_back(shards_[s].applyAndReturn(tensor2.shards_[s], operation));
+        }
+
+        return TensorSharded<opReturnType>(dimensionSizes_, queues_, std::move(resultShards));
+    }
+
+    template <class T>
+    template <apply_callable_parallel<T> C>
+    void TensorSharded<T>::apply(const TensorSharded<T>& tensor2, C&& operation){
+        for(uint64_t s = 0; s < shards_.size(); ++s){
+            TensorParallel<T>::apply(shards_[s], tensor2.shards_[s], operation);
+        }
+    }
+
+    template <class T>
+    template <apply_callable_parallel<T> C>
+    void TensorSharded<T>::apply(const T& operand2, C&& operation){
+        for(TensorParallel<T>& shard : shards_){
+            TensorParallel<T>::apply(shard, operand2, operation);
+        }
+    }
+
+    template <class T>
+    template <foreach_and_return_callable_parallel<T> C>
+    auto TensorSharded<T>::forEachAndReturn(C&& operation) const {
+
+        using opReturnType = decltype(operation(std::declval<T>()));
+
+        std::vector<TensorParallel<opReturnType>> resultShards;
+        resultShards.reserve(shards_.size());
+        for(const TensorParallel<T>& shard : shards_){
+            resultShards.push_back(shard.forEachAndReturn(operation));
+        }
+
+        return TensorSharded<opReturnType>(dimensionSizes_, queues_, std::move(resultShards));
+    }
+
+    template <class T>
+    template <foreach_callable_parallel<T> C>
+    void TensorSharded<T>::forEach(C&& operation){
+        for(TensorParallel<T>& shard : shards_){
+            TensorParallel<T>::forEach(shard, operation);
+        }
+    }
+
+    template <class T>
+    /*static*/ std::vector<uint64_t> TensorSharded<T>::getShardBegins(const LinearContainer<uint64_t>& dimensionSizes,
+    const uint64_t queueCount){
+
+        if(queueCount == 0){
+            throw std::invalid_argument("Sharded tensor needs at least one queue");
+        }
+
+        // Tensor without dimensions has its single item in one shard
+        if(dimensionSizes.size() == 0){
+            return {0, 1};
+        }
+
+        const uint64_t leadingSize = dimensionSizes[0];
+        const uint64_t shardCount = queueCount;
+
+        // Sizes of shards differ at most by one, the first leadingSize % shardCount shards are the longer ones
+        const uint64_t shortSize = leadingSize / shardCount;
+        const uint64_t longCount = leadingSize % shardCount;
+
+        std::vector<uint64_t> shardBegins(shardCount + 1);
+        for(uint64_t s = 0; s <= shardCount; ++s){
+            shardBegins[s] = s * shortSize + std::min(s, longCount);
+        }
+        return shardBegins;
+    }
+
+    template <class T>
+    LinearContainer<uint64_t> TensorSharded<T>::getShardDimensionSizes(const uint64_t shard) const {
+
+        LinearContainer<uint64_t> shardDimensionSizes = dimensionSizes_;
+        if(shardDimensionSizes.size() > 0){
+            shardDimensionSizes[0] = shardBegins_[shard + 1] - shardBegins_[shard];
+        }
+        return shardDimensionSizes;
+    }
+
+    template <class T>
+    uint64_t TensorSharded<T>::getSliceItemCount() const {
+
+        uint64_t sliceItemCount = 1;
+        for(uint64_t i = 1; i < dimensionSizes_.size(); ++i){
+            sliceItemCount *= dimensionSizes_[i];
+        }
+        return sliceItemCount;
+    }
+
+    template <class T>
+    uint64_t TensorSharded<T>::findShard(const uint64_t leadingIndex) const {
+
+        // Empty shards begin where the next one does, the last of equal beginnings is the one holding the index
+        const auto next = std::upper_bound(shardBegins_.begin(), shardBegins_.end(), leadingIndex);
+        return static_cast<uint64_t>(next - shardBegins_.begin()) - 1;
+    }
+
+    template <class T>
+    LinearContainer<uint64_t> TensorSharded<T>::getShardCoordinates(span_view<uint64_t> coordinates, const uint64_t shard) const {
+
+        LinearContainer<uint64_t> shardCoordinates(coordinates.size());
+        std::copy(coordinates.begin(), coordinates.end(), shardCoordinates.begin());
+        if(shardCoordinates.size() > 0){
+            shardCoordinates[0] -= shardBegins_[shard];
+        }
+        return shardCoordinates;
+    }
+
+    template <class T>
+    /*static*/ sycl::event TensorSharded<T>::copyBetweenQueues(T* destination, sycl::queue* destinationQueue, const T* source,
+    sycl::queue* sourceQueue, const uint64_t itemCount, const sycl::event& dependency){
+
+        const uint64_t byteCount = itemCount * sizeof(T);
+
+        if(destinationQueue->get_context() == sourceQueue->get_context()){
+            return destinationQueue->memcpy(destination, source, byteCount, dependency);
+        }
+
+        // USM pointers of other context are not valid, so items go through host
+        LinearContainer<T> stagingItems(itemCount);
+        sourceQueue->memcpy(stagingItems.data(), source, byteCount, dependency).wait();
+        destinationQueue->memcpy(destination, stagingItems.data(), byteCount).wait();
+        return sycl::event();
+    }
+}
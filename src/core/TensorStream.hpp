@@ -0,0 +1,156 @@
+#ifndef TENSOR_STREAM_HPP
+#define TENSOR_STREAM_HPP
+
+#include <cstdint>
+#include <future>
+#include <optional>
+#include <string>
+
+#include "LinearContainer.hpp"
+#include "Tensor.hpp"
+#include "TensorFile.hpp"
+
+namespace gema {
+
+/**
+ * @brief Reads tensor file (see TensorFileHeader) by slabs along the first dimension, so tensors bigger than memory can be
+ * processed. Slab is ordinary Tensor with the first dimension shortened to the slab size.
+ *
+ * @par
+ * forEachSlab reads the next slab in background while the current one is processed, so reading and computation overlap.
+ *
+ * @tparam T type of items, must match the type stored in the file.
+ */
+template <tensor_file_item T>
+class TensorFileReader {
+
+    int descriptor_ = -1;
+    TensorFileHeader header_{};
+    LinearContainer<uint64_t> dimensionSizes_;
+    // Items of one index of the first dimension
+    uint64_t sliceItemCount_ = 0;
+
+    // Reads count items starting at item index first
+    bool readItems(const uint64_t firstItem, const uint64_t itemCount, T* destination) const;
+
+    LinearContainer<uint64_t> getSlabDimensionSizes(const uint64_t slabSize) const;
+
+    public:
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Opens tensor file, only its header and dimension sizes are read.
+     *
+     * @param path path of the file.
+     */
+    explicit TensorFileReader(const std::string& path);
+
+    TensorFileReader(const TensorFileReader&) = delete;
+    TensorFileReader& operator=(const TensorFileReader&) = delete;
+
+    ~TensorFileReader();
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Checks if the file was opened, it fails if the file is missing, is not valid tensor file, stores items of other
+     * type than T or has no dimensions.
+     *
+     * @return Bool @b true if slabs can be read.
+     */
+    bool isOpen() const;
+
+    const TensorFileHeader& getHeader() const;
+
+    const LinearContainer<uint64_t>& getDimensionSizes() const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Reads one slab.
+     *
+     * @param first index of the first dimension where the slab begins.
+     * @param slabSize size of the first dimension of the slab, it is shortened if the tensor ends earlier.
+     *
+     * @return Slab, or nothing if reading failed or first is out of the tensor.
+     */
+    std::optional<Tensor<T>> readSlab(const uint64_t first, const uint64_t slabSize) const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Calls function on all slabs in order. While function works on slab, the next one is read in background. Two
+     * slab tensors are reused for the whole run, so slab must not be kept after the function returns.
+     *
+     * @param slabSize size of the first dimension of slabs, the last slab may be shorter.
+     * @param function callable as function(Tensor<T>& slab, uint64_t first), where first is index of the first dimension
+     * where the slab begins.
+     *
+     * @return Bool @b true if all slabs were read, otherwise the function is not called on the rest of them.
+     */
+    template <typename F>
+    bool forEachSlab(const uint64_t slabSize, F&& function) const;
+};
+
+/**
+ * @brief Writes tensor file (see TensorFileHeader) by slabs along the first dimension, so the whole tensor never has to be
+ * in memory. Slab is written in background while the next one is computed.
+ *
+ * @tparam T type of items.
+ */
+template <tensor_file_item T>
+class TensorFileWriter {
+
+    int descriptor_ = -1;
+    TensorFileHeader header_{};
+    LinearContainer<uint64_t> dimensionSizes_;
+    uint64_t sliceItemCount_ = 0;
+    // Indices of the first dimension passed to writeSlab so far
+    uint64_t writtenCount_ = 0;
+
+    TensorFileChecksumState checksum_;
+    bool failed_ = false;
+
+    // Slab that is being written in background and the write itself
+    Tensor<T> pendingSlab_;
+    std::future<bool> pendingWrite_;
+
+    bool writeBytes(const uint64_t offset, const void* source, const uint64_t byteCount);
+
+    void finishPendingWrite();
+
+    public:
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Creates tensor file of given dimension sizes, existing file is overwritten. Items are written later by slabs.
+     *
+     * @param path path of the file.
+     * @param dimensionSizes dimension sizes of the whole stored tensor, there must be at least one dimension.
+     */
+    TensorFileWriter(const std::string& path, const LinearContainer<uint64_t>& dimensionSizes);
+
+    TensorFileWriter(const TensorFileWriter&) = delete;
+    TensorFileWriter& operator=(const TensorFileWriter&) = delete;
+
+    /// Closes the file if it was not closed yet.
+    ~TensorFileWriter();
+
+    bool isOpen() const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Writes next slab after the previously written ones. Returns as soon as the previous slab is written, this one
+     * is written in background.
+     *
+     * @param slab slab with all dimensions but the first one equal to those of the file.
+     *
+     * @return Bool @b false if the slab does not fit into the file or any write failed so far.
+     */
+    bool writeSlab(Tensor<T>&& slab);
+    bool writeSlab(const Tensor<T>& slab);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Waits for the last write, stores checksum into the header and closes the file.
+     *
+     * @return Bool @b true if all items of the tensor were written without error.
+     */
+    bool close();
+};
+
+}
+
+#include "TensorStream.tpp"
+
+#endif
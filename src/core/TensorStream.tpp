@@ -0,0 +1,268 @@
+#include <algorithm>
+#include <array>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "TensorStream.hpp"
+
+namespace gema {
+
+    // READER: ----------------------------------------------------------------------------------------------------------------
+
+    template <tensor_file_item T>
+    TensorFileReader<T>::TensorFileReader(const std::string& path){
+
+        descriptor_ = ::open(path.c_str(), O_RDONLY);
+        if(descriptor_ < 0) return;
+
+        struct stat status;
+        const bool valid = ::fstat(descriptor_, &status) == 0
+            && static_cast<uint64_t>(status.st_size) >= sizeof(TensorFileHeader)
+            && ::pread(descriptor_, &header_, sizeof(header_), 0) == sizeof(header_)
+            && detail::isValidTensorFileHeader(header_, static_cast<uint64_t>(status.st_size))
+            && header_.itemType == static_cast<uint32_t>(tensorFileType<T>()) && header_.itemSize == sizeof(T)
+            && header_.rank > 0;
+
+        if(valid){
+
+            const uint64_t metadataBytes = header_.rank * sizeof(uint64_t);
+            dimensionSizes_.resize(header_.rank);
+
+            if(::pread(descriptor_, dimensionSizes_.data(), metadataBytes, sizeof(TensorFileHeader)) == ssize_t(metadataBytes)
+            && detail::hasMatchingItemCount(header_, dimensionSizes_.data())){
+
+                sliceItemCount_ = dimensionSizes_[0] > 0 ? header_.itemCount / dimensionSizes_[0] : 0;
+                return;
+            }
+        }
+
+        ::close(descriptor_);
+        descriptor_ = -1;
+    }
+
+    template <tensor_file_item T>
+    TensorFileReader<T>::~TensorFileReader(){
+
+        if(descriptor_ >= 0){
+            ::close(descriptor_);
+        }
+    }
+
+    template <tensor_file_item T>
+    bool TensorFileReader<T>::isOpen() const{
+        return descriptor_ >= 0;
+    }
+
+    template <tensor_file_item T>
+    const TensorFileHeader& TensorFileReader<T>::getHeader() const{
+        return header_;
+    }
+
+    template <tensor_file_item T>
+    const LinearContainer<uint64_t>& TensorFileReader<T>::getDimensionSizes() const{
+        return dimensionSizes_;
+    }
+
+    template <tensor_file_item T>
+    std::optional<Tensor<T>> TensorFileReader<T>::readSlab(const uint64_t first, const uint64_t slabSize) const{
+
+        if(!isOpen() || first >= dimensionSizes_[0]) return std::nullopt;
+
+        const uint64_t count = std::min(slabSize, dimensionSizes_[0] - first);
+
+        Tensor<T> slab(getSlabDimensionSizes(count));
+        if(!readItems(first * sliceItemCount_, count * sliceItemCount_, slab.getData())) return std::nullopt;
+
+        return slab;
+    }
+
+    template <tensor_file_item T>
+    template <typename F>
+    bool TensorFileReader<T>::forEachSlab(const uint64_t slabSize, F&& function) const{
+
+        if(!isOpen() || slabSize == 0) return false;
+
+        const uint64_t leadingSize = dimensionSizes_[0];
+
+        // Slab tensors are allocated once, only the shorter last slab needs its own
+        const auto readSlabInto = [this, slabSize, leadingSize](Tensor<T>* slab, const uint64_t first){
+
+            const uint64_t count = std::min(slabSize, leadingSize - first);
+
+            if(slab->getNumberOfDimensions() == 0 || slab->getDimensionSizes()[0] != count){
+                *slab = Tensor<T>(getSlabDimensionSizes(count));
+            }
+
+            return readItems(first * sliceItemCount_, count * sliceItemCount_, slab->getData());
+        };
+
+        if(leadingSize == 0) return true;
+
+        std::array<Tensor<T>, 2> slabs;
+        std::future<bool> pendingRead = std::async(std::launch::async, readSlabInto, &slabs[0], 0);
+
+        for(uint64_t first = 0, k = 0; first < leadingSize; first += slabSize, ++k){
+
+            if(!pendingRead.get()) return false;
+
+            const uint64_t next = first + slabSize;
+            if(next < leadingSize){
+                pendingRead = std::async(std::launch::async, readSlabInto, &slabs[(k + 1) % 2], next);
+            }
+
+            function(slabs[k % 2], first);
+        }
+
+        return true;
+    }
+
+    template <tensor_file_item T>
+    bool TensorFileReader<T>::readItems(const uint64_t firstItem, const uint64_t itemCount, T* destination) const{
+
+        std::byte* bytes = reinterpret_cast<std::byte*>(destination);
+        uint64_t offset = header_.dataOffset + firstItem * sizeof(T);
+        uint64_t remaining = itemCount * sizeof(T);
+
+        // Single read may return less than asked, for example above 2 GB on Linux
+        while(remaining > 0){
+
+            const ssize_t result = ::pread(descriptor_, bytes, remaining, offset);
+            if(result <= 0) return false;
+
+            bytes += result;
+            offset += result;
+            remaining -= result;
+        }
+
+        return true;
+    }
+
+    template <tensor_file_item T>
+    LinearContainer<uint64_t> TensorFileReader<T>::getSlabDimensionSizes(const uint64_t slabSize) const{
+
+        LinearContainer<uint64_t> slabDimensionSizes = dimensionSizes_;
+        slabDimensionSizes[0] = slabSize;
+        return slabDimensionSizes;
+    }
+
+
+
+    // WRITER: ----------------------------------------------------------------------------------------------------------------
+
+    template <tensor_file_item T>
+    TensorFileWriter<T>::TensorFileWriter(const std::string& path, const LinearContainer<uint64_t>& dimensionSizes)
+    : dimensionSizes_(dimensionSizes){
+
+        if(dimensionSizes_.size() == 0) return;
+
+        uint64_t itemCount = 1;
+        for(const uint64_t dimensionSize : dimensionSizes_){
+            itemCount *= dimensionSize;
+        }
+
+        header_ = detail::makeTensorFileHeader<T>(dimensionSizes_.size(), itemCount);
+        sliceItemCount_ = dimensionSizes_[0] > 0 ? itemCount / dimensionSizes_[0] : 0;
+
+        descriptor_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if(descriptor_ < 0) return;
+
+        // File gets its final size at once, padding before the items stays zero
+        const bool valid = ::ftruncate(descriptor_, header_.dataOffset + itemCount * sizeof(T)) == 0
+            && writeBytes(0, &header_, sizeof(header_))
+            && writeBytes(sizeof(header_), dimensionSizes_.data(), dimensionSizes_.size() * sizeof(uint64_t));
+
+        if(!valid){
+            ::close(descriptor_);
+            descriptor_ = -1;
+        }
+    }
+
+    template <tensor_file_item T>
+    TensorFileWriter<T>::~TensorFileWriter(){
+        close();
+    }
+
+    template <tensor_file_item T>
+    bool TensorFileWriter<T>::isOpen() const{
+        return descriptor_ >= 0;
+    }
+
+    template <tensor_file_item T>
+    bool TensorFileWriter<T>::writeSlab(Tensor<T>&& slab){
+
+        if(!isOpen() || failed_) return false;
+
+        const auto& slabDimensionSizes = slab.getDimensionSizes();
+        if(slabDimensionSizes.size() != dimensionSizes_.size()) return false;
+        if(!std::equal(slabDimensionSizes.begin() + 1, slabDimensionSizes.end(), dimensionSizes_.begin() + 1)) return false;
+
+        const uint64_t count = slabDimensionSizes[0];
+        if(count > dimensionSizes_[0] - writtenCount_) return false;
+
+        finishPendingWrite();
+        if(failed_) return false;
+
+        pendingSlab_ = std::move(slab);
+
+        const uint64_t offset = header_.dataOffset + writtenCount_ * sliceItemCount_ * sizeof(T);
+        writtenCount_ += count;
+
+        // Slabs are written one after another, so the checksum gets the items in the file order
+        pendingWrite_ = std::async(std::launch::async, [this, offset](){
+            const uint64_t byteCount = pendingSlab_.getNumberOfItems() * sizeof(T);
+            checksum_.update(pendingSlab_.getData(), byteCount);
+            return writeBytes(offset, pendingSlab_.getData(), byteCount);
+        });
+
+        return true;
+    }
+
+    template <tensor_file_item T>
+    bool TensorFileWriter<T>::writeSlab(const Tensor<T>& slab){
+        return writeSlab(Tensor<T>(slab));
+    }
+
+    template <tensor_file_item T>
+    bool TensorFileWriter<T>::close(){
+
+        if(!isOpen()) return false;
+
+        finishPendingWrite();
+
+        header_.checksum = checksum_.get();
+        const bool headerWritten = writeBytes(0, &header_, sizeof(header_));
+
+        const bool closed = ::close(descriptor_) == 0;
+        descriptor_ = -1;
+
+        return !failed_ && headerWritten && closed && writtenCount_ == dimensionSizes_[0];
+    }
+
+    template <tensor_file_item T>
+    bool TensorFileWriter<T>::writeBytes(uint64_t offset, const void* source, uint64_t byteCount){
+
+        const std::byte* bytes = static_cast<const std::byte*>(source);
+
+        while(byteCount > 0){
+
+            const ssize_t result = ::pwrite(descriptor_, bytes, byteCount, offset);
+            if(result <= 0) return false;
+
+            bytes += result;
+            offset += result;
+            byteCount -= result;
+        }
+
+        return true;
+    }
+
+    template <tensor_file_item T>
+    void TensorFileWriter<T>::finishPendingWrite(){
+
+        if(pendingWrite_.valid() && !pendingWrite_.get()){
+            failed_ = true;
+        }
+    }
+}
@@ -0,0 +1,260 @@
+#ifndef TENSOR_VIEW_HPP
+#define TENSOR_VIEW_HPP
+
+#include <cstdint>
+#include <type_traits>
+
+#include "TensorConcept.hpp"
+#include "LinearContainer.hpp"
+#include "MemoryBackendConcept.hpp"
+#include "MemoryBackend.hpp"
+#include "Tensor.hpp"
+
+namespace gema{
+
+// ============================================================================================================================
+/**
+ * @brief Non-owning strided view into data of a tensor.
+ *
+ * @par
+ * View does not copy any items, it only refers to data container of the tensor it was made from. Item on coordinates
+ * [c0, c1, ..., cn] is found on index offset + c0 * jump0 + c1 * jump1 + ... + cn * jumpn of that container, where jumps
+ * have the same meaning as Tensor<T>::dimensionJumps_, but are not required to describe dense data. Because of that, slicing,
+ * permutation of dimensions, broadcasting and squeezing only change the offset and the jumps and cost nothing compared to
+ * copying the items.
+ *
+ * @par
+ * Jump of zero means that all coordinates of that dimension refer to the same item, which is how broadcasting works. Writing
+ * through such view writes the same item multiple times.
+ *
+ * @par
+ * Lifetime
+ * @par
+ * View is valid only until the data of the tensor it refers to is reallocated, for example by resize, transposition,
+ * assignment or destruction of that tensor. Like the tensor itself, view does not check validity of its arguments.
+ *
+ * @tparam T type of items, const T makes a read only view.
+ */
+template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+class TensorView {
+
+    template<class U, MemoryBackendConcept<std::remove_const_t<U>> DMB, MemoryBackendConcept<uint64_t> MDMB>
+    friend class TensorView;
+
+    public:
+
+    using value_type = std::remove_const_t<T>;
+
+    using DataContainer = std::conditional_t<std::is_const_v<T>,
+        const LinearContainer<value_type, DataMB>, LinearContainer<value_type, DataMB>>;
+    using MetadataContainer = LinearContainer<uint64_t, MetadataMB, Tensor<value_type, DataMB, MetadataMB>::metadataInlineRank>;
+
+    private:
+
+    /// Data container of the viewed tensor.
+    DataContainer* container_;
+    /// Index of the item on zero coordinates in the container.
+    uint64_t offset_;
+    /// Size of every view dimension.
+    MetadataContainer dimensionSizes_;
+    /// Jump in the container corresponding to one increment of n-th coordinate, can be zero.
+    MetadataContainer dimensionJumps_;
+
+    public:
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Makes view of the whole tensor with the same dimensions.
+     *
+     * @param tensor tensor to view, must outlive the view.
+     */
+    TensorView(Tensor<value_type, DataMB, MetadataMB>& tensor) requires(!std::is_const_v<T>);
+    TensorView(const Tensor<value_type, DataMB, MetadataMB>& tensor) requires(std::is_const_v<T>);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Makes read only view from writable one.
+     *
+     * @param otherView view to take the items from.
+     */
+    TensorView(const TensorView<value_type, DataMB, MetadataMB>& otherView) requires(std::is_const_v<T>);
+
+    const MetadataContainer& getDimensionSizes() const;
+    const MetadataContainer& getDimensionJumps() const;
+    uint64_t getOffset() const;
+    uint64_t getNumberOfDimensions() const;
+    uint64_t getNumberOfItems() const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Gets reference to item on provided coordinates of the view.
+     *
+     * @param coordinates coordinates of the item in the view.
+     *
+     * @return Reference to item in the viewed tensor.
+     */
+    T& getItem(span_view<uint64_t> coordinates) const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Sets item on provided coordinates of the view, which writes into the viewed tensor.
+     *
+     * @param value value to store.
+     * @param coordinates coordinates of the item in the view.
+     */
+    void setItem(const value_type& value, span_view<uint64_t> coordinates) const requires(!std::is_const_v<T>);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Checks if the view describes dense data in the same order a tensor of the same dimensions would store them.
+     *
+     * @return Bool @b true if items of the view are one contiguous range in the container.
+     */
+    bool isContiguous() const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Makes view of sub-box of this view, number of dimensions stays the same.
+     *
+     * @param fromCoordsInclusive first coordinates in the sub-box.
+     * @param toCoordsExclusive coordinates behind the last item in every dimension.
+     *
+     * @return View of the sub-box.
+     */
+    TensorView<T, DataMB, MetadataMB> slice(span_view<uint64_t> fromCoordsInclusive, span_view<uint64_t> toCoordsExclusive) const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Fixes one coordinate and makes view of the rest, which has one dimension less.
+     *
+     * @param dimensionIndex dimension whose coordinate is fixed.
+     * @param coordinate the fixed coordinate.
+     *
+     * @return View without the dimension.
+     */
+    TensorView<T, DataMB, MetadataMB> select(const uint64_t dimensionIndex, const uint64_t coordinate) const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Reorders dimensions, n-th dimension of the result is dimensionOrder[n]-th dimension of this view. Swapping two
+     * dimensions this way is transposition without moving any item.
+     *
+     * @param dimensionOrder permutation of dimension indices.
+     *
+     * @return View with reordered dimensions.
+     */
+    TensorView<T, DataMB, MetadataMB> permute(span_view<uint64_t> dimensionOrder) const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Expands view to given dimension sizes. Dimensions are matched from the last one, every dimension of this view must
+     * be either of the same size, or of size one, which is then repeated. Missing leading dimensions are added and repeated
+     * too. Repeated dimensions have zero jump.
+     *
+     * @param newDimensionSizes dimension sizes of the result, at least as many as this view has.
+     *
+     * @return Broadcasted view.
+     */
+    TensorView<T, DataMB, MetadataMB> broadcast(span_view<uint64_t> newDimensionSizes) const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Removes all dimensions of size one.
+     *
+     * @return View without dimensions of size one.
+     */
+    TensorView<T, DataMB, MetadataMB> squeeze() const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Removes one dimension, that should have size one.
+     *
+     * @param dimensionIndex dimension to remove.
+     *
+     * @return View without the dimension.
+     */
+    TensorView<T, DataMB, MetadataMB> squeeze(const uint64_t dimensionIndex) const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Copies items of the view into new dense tensor.
+     *
+     * @return Tensor with the same dimensions and items as the view.
+     */
+    Tensor<value_type, DataMB, MetadataMB> materialize() const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Applies operation on all items of the view. Items are visited in order of ascending coordinates.
+     *
+     * @param operation unary operation, having correct signature defined in concept.
+     */
+    template <foreach_callable<T> C>
+    void forEach(C&& operation) const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Applies operation on all items of the view and stores results into new dense tensor.
+     *
+     * @param operation unary operation returning the item of the result.
+     *
+     * @return Tensor with results.
+     */
+    template <foreach_and_return_callable<value_type> C>
+    auto forEachAndReturn(C&& operation) const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Applies operation between each item of this view and item on the same coordinates of other view, result is
+     * stored into this view. Tensors are accepted too, through view of the whole tensor.
+     *
+     * @param otherView second operand, should have the same dimension sizes.
+     * @param operation a binary function that defines operation between two items.
+     */
+    template <apply_callable<value_type> C>
+    void apply(const TensorView<const value_type, DataMB, MetadataMB>& otherView, C&& operation) const
+    requires(!std::is_const_v<T>);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Applies operation between each item of this view and given value, result is stored into this view.
+     *
+     * @param value second operand.
+     * @param operation a binary function that defines operation between two items.
+     */
+    template <apply_callable<value_type> C>
+    void apply(const value_type& value, C&& operation) const requires(!std::is_const_v<T>);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Applies operation between each item of this view and item on the same coordinates of other view and stores
+     * results into new dense tensor.
+     *
+     * @param otherView second operand, should have the same dimension sizes.
+     * @param operation a binary function that defines operation between two items.
+     *
+     * @return Tensor with results.
+     */
+    template <apply_and_return_callable<value_type> C>
+    auto applyAndReturn(const TensorView<const value_type, DataMB, MetadataMB>& otherView, C&& operation) const;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Reduces all items of the view by given operation.
+     *
+     * @param operation associative and commutative binary operation.
+     * @param init value the reduction starts with.
+     *
+     * @return Result of the reduction.
+     */
+    template <reduce_callable<value_type> C>
+    value_type reduce(C&& operation, const value_type& init) const;
+
+    private:
+
+    TensorView(DataContainer* container, const uint64_t offset, MetadataContainer&& dimensionSizes,
+    MetadataContainer&& dimensionJumps);
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Walks all coordinates of given dimension sizes in ascending order and calls function with indices of the item in
+     * two strided layouts. The last dimension is walked by plain loop and the rest only when it overflows.
+     *
+     * @param dimensionSizes dimension sizes shared by both layouts.
+     * @param jumps1 jumps of the first layout.
+     * @param offset1 index of the first item of the first layout.
+     * @param jumps2 jumps of the second layout.
+     * @param offset2 index of the first item of the second layout.
+     * @param function void(uint64_t, uint64_t) callable.
+     */
+    template <typename F>
+    static void walkIndices(span_view<uint64_t> dimensionSizes, span_view<uint64_t> jumps1, const uint64_t offset1,
+    span_view<uint64_t> jumps2, const uint64_t offset2, F&& function);
+}; // end TensorView
+
+} // end gema
+
+#include "TensorView.tpp"
+
+#endif
@@ -0,0 +1,374 @@
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "TensorView.hpp"
+
+namespace gema{
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    TensorView<T, DataMB, MetadataMB>::TensorView(Tensor<value_type, DataMB, MetadataMB>& tensor) requires(!std::is_const_v<T>)
+    : TensorView(&tensor.getDataContainer(), 0, MetadataContainer(tensor.getDimensionSizes()),
+    MetadataContainer(tensor.getDimensionSizes().size())){
+
+        uint64_t jump = 1;
+        for(uint64_t i = dimensionSizes_.size(); i-- > 0;){
+            dimensionJumps_[i] = jump;
+            jump *= dimensionSizes_[i];
+        }
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    TensorView<T, DataMB, MetadataMB>::TensorView(const Tensor<value_type, DataMB, MetadataMB>& tensor) requires(std::is_const_v<T>)
+    : TensorView(&tensor.getDataContainer(), 0, MetadataContainer(tensor.getDimensionSizes()),
+    MetadataContainer(tensor.getDimensionSizes().size())){
+
+        uint64_t jump = 1;
+        for(uint64_t i = dimensionSizes_.size(); i-- > 0;){
+            dimensionJumps_[i] = jump;
+            jump *= dimensionSizes_[i];
+        }
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    TensorView<T, DataMB, MetadataMB>::TensorView(const TensorView<value_type, DataMB, MetadataMB>& otherView)
+    requires(std::is_const_v<T>)
+    : container_(otherView.container_), offset_(otherView.offset_), dimensionSizes_(otherView.dimensionSizes_),
+    dimensionJumps_(otherView.dimensionJumps_){}
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    TensorView<T, DataMB, MetadataMB>::TensorView(DataContainer* container, const uint64_t offset,
+    MetadataContainer&& dimensionSizes, MetadataContainer&& dimensionJumps)
+    : container_(container), offset_(offset), dimensionSizes_(std::move(dimensionSizes)),
+    dimensionJumps_(std::move(dimensionJumps)){}
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    const typename TensorView<T, DataMB, MetadataMB>::MetadataContainer& TensorView<T, DataMB, MetadataMB>::getDimensionSizes() const{
+        return dimensionSizes_;
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    const typename TensorView<T, DataMB, MetadataMB>::MetadataContainer& TensorView<T, DataMB, MetadataMB>::getDimensionJumps() const{
+        return dimensionJumps_;
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    uint64_t TensorView<T, DataMB, MetadataMB>::getOffset() const{
+        return offset_;
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    uint64_t TensorView<T, DataMB, MetadataMB>::getNumberOfDimensions() const{
+        return dimensionSizes_.size();
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    uint64_t TensorView<T, DataMB, MetadataMB>::getNumberOfItems() const{
+
+        uint64_t itemCount = 1;
+        for(const uint64_t dimensionSize : dimensionSizes_){
+            itemCount *= dimensionSize;
+        }
+
+        return itemCount;
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    T& TensorView<T, DataMB, MetadataMB>::getItem(span_view<uint64_t> coordinates) const{
+
+        uint64_t itemIndex = offset_;
+        for(uint64_t i = 0; i < dimensionJumps_.size(); ++i){
+            itemIndex += coordinates[i] * dimensionJumps_[i];
+        }
+
+        return container_->data()[itemIndex];
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    void TensorView<T, DataMB, MetadataMB>::setItem(const value_type& value, span_view<uint64_t> coordinates) const
+    requires(!std::is_const_v<T>){
+        getItem(coordinates) = value;
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    bool TensorView<T, DataMB, MetadataMB>::isContiguous() const{
+
+        // Jumps of dimensions of size one never take effect
+        uint64_t jump = 1;
+        for(uint64_t i = dimensionSizes_.size(); i-- > 0;){
+
+            if(dimensionSizes_[i] == 1) continue;
+            if(dimensionJumps_[i] != jump) return false;
+
+            jump *= dimensionSizes_[i];
+        }
+
+        return true;
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    TensorView<T, DataMB, MetadataMB> TensorView<T, DataMB, MetadataMB>::slice(
+        span_view<uint64_t> fromCoordsInclusive,
+        span_view<uint64_t> toCoordsExclusive
+    ) const {
+
+        MetadataContainer newDimensionSizes(dimensionSizes_.size());
+        uint64_t newOffset = offset_;
+
+        for(uint64_t i = 0; i < dimensionSizes_.size(); ++i){
+            newDimensionSizes[i] = toCoordsExclusive[i] - fromCoordsInclusive[i];
+            newOffset += fromCoordsInclusive[i] * dimensionJumps_[i];
+        }
+
+        return TensorView<T, DataMB, MetadataMB>(container_, newOffset, std::move(newDimensionSizes),
+            MetadataContainer(dimensionJumps_));
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    TensorView<T, DataMB, MetadataMB> TensorView<T, DataMB, MetadataMB>::select(
+        const uint64_t dimensionIndex,
+        const uint64_t coordinate
+    ) const {
+
+        const uint64_t newDimensionCount = dimensionSizes_.size() - 1;
+        MetadataContainer newDimensionSizes(newDimensionCount);
+        MetadataContainer newDimensionJumps(newDimensionCount);
+
+        for(uint64_t i = 0, j = 0; i < dimensionSizes_.size(); ++i){
+
+            if(i == dimensionIndex) continue;
+
+            newDimensionSizes[j] = dimensionSizes_[i];
+            newDimensionJumps[j] = dimensionJumps_[i];
+            ++j;
+        }
+
+        return TensorView<T, DataMB, MetadataMB>(container_, offset_ + coordinate * dimensionJumps_[dimensionIndex],
+            std::move(newDimensionSizes), std::move(newDimensionJumps));
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    TensorView<T, DataMB, MetadataMB> TensorView<T, DataMB, MetadataMB>::permute(span_view<uint64_t> dimensionOrder) const {
+
+        MetadataContainer newDimensionSizes(dimensionSizes_.size());
+        MetadataContainer newDimensionJumps(dimensionSizes_.size());
+
+        for(uint64_t i = 0; i < dimensionSizes_.size(); ++i){
+            newDimensionSizes[i] = dimensionSizes_[dimensionOrder[i]];
+            newDimensionJumps[i] = dimensionJumps_[dimensionOrder[i]];
+        }
+
+        return TensorView<T, DataMB, MetadataMB>(container_, offset_, std::move(newDimensionSizes),
+            std::move(newDimensionJumps));
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    TensorView<T, DataMB, MetadataMB> TensorView<T, DataMB, MetadataMB>::broadcast(span_view<uint64_t> newDimensionSizes) const {
+
+        const uint64_t newDimensionCount = newDimensionSizes.size();
+        const uint64_t addedDimensionCount = newDimensionCount - dimensionSizes_.size();
+
+        MetadataContainer broadcastedSizes(newDimensionCount);
+        MetadataContainer broadcastedJumps(newDimensionCount);
+
+        for(uint64_t i = 0; i < newDimensionCount; ++i){
+
+            broadcastedSizes[i] = newDimensionSizes[i];
+
+            if(i < addedDimensionCount){
+                broadcastedJumps[i] = 0;
+                continue;
+            }
+
+            const uint64_t oldIndex = i - addedDimensionCount;
+            const bool repeated = dimensionSizes_[oldIndex] == 1 && newDimensionSizes[i] != 1;
+            broadcastedJumps[i] = repeated ? 0 : dimensionJumps_[oldIndex];
+        }
+
+        return TensorView<T, DataMB, MetadataMB>(container_, offset_, std::move(broadcastedSizes),
+            std::move(broadcastedJumps));
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    TensorView<T, DataMB, MetadataMB> TensorView<T, DataMB, MetadataMB>::squeeze() const {
+
+        const uint64_t newDimensionCount =
+            dimensionSizes_.size() - std::count(dimensionSizes_.begin(), dimensionSizes_.end(), uint64_t{1});
+
+        MetadataContainer newDimensionSizes(newDimensionCount);
+        MetadataContainer newDimensionJumps(newDimensionCount);
+
+        for(uint64_t i = 0, j = 0; i < dimensionSizes_.size(); ++i){
+
+            if(dimensionSizes_[i] == 1) continue;
+
+            newDimensionSizes[j] = dimensionSizes_[i];
+            newDimensionJumps[j] = dimensionJumps_[i];
+            ++j;
+        }
+
+        return TensorView<T, DataMB, MetadataMB>(container_, offset_, std::move(newDimensionSizes),
+            std::move(newDimensionJumps));
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    TensorView<T, DataMB, MetadataMB> TensorView<T, DataMB, MetadataMB>::squeeze(const uint64_t dimensionIndex) const {
+        return select(dimensionIndex, 0);
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    Tensor<typename TensorView<T, DataMB, MetadataMB>::value_type, DataMB, MetadataMB>
+    TensorView<T, DataMB, MetadataMB>::materialize() const {
+        return forEachAndReturn([](const value_type& item){
+            return item;
+        });
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    template <foreach_callable<T> C>
+    void TensorView<T, DataMB, MetadataMB>::forEach(C&& operation) const {
+
+        T* data = container_->data();
+
+        walkIndices(dimensionSizes_, dimensionJumps_, offset_, dimensionJumps_, offset_,
+        [data, &operation](const uint64_t itemIndex, const uint64_t){
+            operation(data[itemIndex]);
+        });
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    template <foreach_and_return_callable<typename TensorView<T, DataMB, MetadataMB>::value_type> C>
+    auto TensorView<T, DataMB, MetadataMB>::forEachAndReturn(C&& operation) const {
+
+        using opReturnType = materialized_t<decltype(operation(std::declval<value_type>()))>;
+        Tensor<opReturnType> resultTensor = Tensor<opReturnType>(dimensionSizes_);
+
+        opReturnType* resultData = resultTensor.getData();
+        const T* data = container_->data();
+
+        uint64_t resultIndex = 0;
+        walkIndices(dimensionSizes_, dimensionJumps_, offset_, dimensionJumps_, offset_,
+        [data, resultData, &resultIndex, &operation](const uint64_t itemIndex, const uint64_t){
+            resultData[resultIndex++] = operation(data[itemIndex]);
+        });
+
+        return resultTensor;
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    template <apply_callable<typename TensorView<T, DataMB, MetadataMB>::value_type> C>
+    void TensorView<T, DataMB, MetadataMB>::apply(
+        const TensorView<const value_type, DataMB, MetadataMB>& otherView,
+        C&& operation
+    ) const requires(!std::is_const_v<T>){
+
+        T* data = container_->data();
+        const value_type* otherData = otherView.container_->data();
+
+        walkIndices(dimensionSizes_, dimensionJumps_, offset_, otherView.dimensionJumps_, otherView.offset_,
+        [data, otherData, &operation](const uint64_t itemIndex, const uint64_t otherItemIndex){
+            operation(data[itemIndex], otherData[otherItemIndex]);
+        });
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    template <apply_callable<typename TensorView<T, DataMB, MetadataMB>::value_type> C>
+    void TensorView<T, DataMB, MetadataMB>::apply(const value_type& value, C&& operation) const requires(!std::is_const_v<T>){
+
+        forEach([&value, &operation](T& item){
+            operation(item, value);
+        });
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    template <apply_and_return_callable<typename TensorView<T, DataMB, MetadataMB>::value_type> C>
+    auto TensorView<T, DataMB, MetadataMB>::applyAndReturn(
+        const TensorView<const value_type, DataMB, MetadataMB>& otherView,
+        C&& operation
+    ) const {
+
+        using opReturnType = materialized_t<decltype(operation(std::declval<value_type>(), std::declval<value_type>()))>;
+        Tensor<opReturnType> resultTensor = Tensor<opReturnType>(dimensionSizes_);
+
+        opReturnType* resultData = resultTensor.getData();
+        const T* data = container_->data();
+        const value_type* otherData = otherView.container_->data();
+
+        uint64_t resultIndex = 0;
+        walkIndices(dimensionSizes_, dimensionJumps_, offset_, otherView.dimensionJumps_, otherView.offset_,
+        [data, otherData, resultData, &resultIndex, &operation](const uint64_t itemIndex, const uint64_t otherItemIndex){
+            resultData[resultIndex++] = operation(data[itemIndex], otherData[otherItemIndex]);
+        });
+
+        return resultTensor;
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    template <reduce_callable<typename TensorView<T, DataMB, MetadataMB>::value_type> C>
+    typename TensorView<T, DataMB, MetadataMB>::value_type TensorView<T, DataMB, MetadataMB>::reduce(
+        C&& operation,
+        const value_type& init
+    ) const {
+
+        value_type result = init;
+        forEach([&result, &operation](const value_type& item){
+            result = operation(result, item);
+        });
+
+        return result;
+    }
+
+    template<class T, MemoryBackendConcept<std::remove_const_t<T>> DataMB, MemoryBackendConcept<uint64_t> MetadataMB>
+    template <typename F>
+    /*static*/ void TensorView<T, DataMB, MetadataMB>::walkIndices(
+        span_view<uint64_t> dimensionSizes,
+        span_view<uint64_t> jumps1,
+        const uint64_t offset1,
+        span_view<uint64_t> jumps2,
+        const uint64_t offset2,
+        F&& function
+    ){
+
+        const uint64_t dimensionCount = dimensionSizes.size();
+
+        if(dimensionCount == 0){
+            function(offset1, offset2);
+            return;
+        }
+
+        if(std::find(dimensionSizes.begin(), dimensionSizes.end(), uint64_t{0}) != dimensionSizes.end()) return;
+
+        const uint64_t lastDimension = dimensionCount - 1;
+        const uint64_t innerSize = dimensionSizes[lastDimension];
+        const uint64_t innerJump1 = jumps1[lastDimension];
+        const uint64_t innerJump2 = jumps2[lastDimension];
+
+        std::vector<uint64_t> coordinates(dimensionCount, 0);
+        uint64_t rowIndex1 = offset1;
+        uint64_t rowIndex2 = offset2;
+
+        while(true){
+
+            for(uint64_t i = 0; i < innerSize; ++i){
+                function(rowIndex1 + i * innerJump1, rowIndex2 + i * innerJump2);
+            }
+
+            // Odometer over the outer dimensions, indices are moved by the jumps instead of being recomputed
+            uint64_t dimension = lastDimension;
+            while(dimension-- > 0){
+
+                ++coordinates[dimension];
+                rowIndex1 += jumps1[dimension];
+                rowIndex2 += jumps2[dimension];
+
+                if(coordinates[dimension] < dimensionSizes[dimension]) break;
+
+                rowIndex1 -= coordinates[dimension] * jumps1[dimension];
+                rowIndex2 -= coordinates[dimension] * jumps2[dimension];
+                coordinates[dimension] = 0;
+            }
+
+            if(dimension > lastDimension) return;
+        }
+    }
+}
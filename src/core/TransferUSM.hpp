@@ -0,0 +1,82 @@
+#ifndef TRANSFER_USM_HPP
+#define TRANSFER_USM_HPP
+
+#include <cstdint>
+
+#include <sycl/sycl.hpp>
+
+#include "MemoryPoolUSM.hpp"
+
+namespace gema {
+
+/**
+ * @brief Copies between ordinary host memory and device USM memory by chunks staged through pinned host buffers of the
+ * queue's host pool (see MemoryPoolUSM). While one chunk is copied by the device, the host moves the next one between its
+ * memory and the other staging buffer, so both sides work at once. Callback called for every chunk lets the caller start
+ * working on it before the rest is transferred.
+ *
+ * @par
+ * Copies not bigger than one chunk are done directly, staging would only add a host copy to them.
+ */
+class TransferUSM {
+
+    // Number of staging buffers used in turn
+    constexpr static uint64_t stagingBufferCount_ = 2;
+
+    public:
+
+    /// Default size of one chunk in bytes.
+    constexpr static uint64_t defaultChunkBytes = uint64_t(4) << 20;
+
+    TransferUSM() = delete;
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Copies items from host to device memory. Returns when the whole source is read, copies of the last chunks and
+     * kernels submitted by onChunk may still run.
+     *
+     * @param queue queue of the device memory.
+     * @param destination device memory for count items.
+     * @param source host memory of count items, it may be released when the function returns.
+     * @param count number of items.
+     * @param dependency event after which the device memory may be written.
+     * @param onChunk callable as onChunk(sycl::event chunkCopied, uint64_t firstItem, uint64_t itemCount), called in order
+     * as soon as copy of every chunk is submitted, for example to submit kernel on the chunk depending on chunkCopied.
+     * @param chunkBytes size of one chunk in bytes.
+     *
+     * @return Event after which all items are in the destination and staging buffers are back in the pool.
+     */
+    template <class T, typename F>
+    static sycl::event upload(sycl::queue& queue, T* destination, const T* source, const uint64_t count,
+    const sycl::event& dependency, F&& onChunk, const uint64_t chunkBytes = defaultChunkBytes);
+
+    template <class T>
+    static sycl::event upload(sycl::queue& queue, T* destination, const T* source, const uint64_t count,
+    const sycl::event& dependency = sycl::event());
+
+    /** -----------------------------------------------------------------------------------------------------------------------
+     * @brief Copies items from device to host memory. The next chunk is copied by the device while onChunk works on the
+     * previous one.
+     *
+     * @param queue queue of the device memory.
+     * @param destination host memory for count items.
+     * @param source device memory of count items.
+     * @param count number of items.
+     * @param dependency event after which the device memory may be read.
+     * @param onChunk callable as onChunk(uint64_t firstItem, uint64_t itemCount), called in order when the chunk is in
+     * the destination.
+     * @param chunkBytes size of one chunk in bytes.
+     */
+    template <class T, typename F>
+    static void download(sycl::queue& queue, T* destination, const T* source, const uint64_t count,
+    const sycl::event& dependency, F&& onChunk, const uint64_t chunkBytes = defaultChunkBytes);
+
+    template <class T>
+    static void download(sycl::queue& queue, T* destination, const T* source, const uint64_t count,
+    const sycl::event& dependency = sycl::event());
+};
+
+}
+
+#include "TransferUSM.tpp"
+
+#endif
@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include "TransferUSM.hpp"
+
+namespace gema {
+
+    template <class T, typename F>
+    /*static*/ sycl::event TransferUSM::upload(sycl::queue& queue, T* destination, const T* source, const uint64_t count,
+    const sycl::event& dependency, F&& onChunk, const uint64_t chunkBytes){
+
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        if(count == 0) return dependency;
+
+        const uint64_t chunkItems = std::max<uint64_t>(1, chunkBytes / sizeof(T));
+
+        if(count <= chunkItems){
+            sycl::event copied = queue.memcpy(destination, source, count * sizeof(T), dependency);
+            onChunk(copied, uint64_t(0), count);
+
+            // Device reads the source itself, so it must not be left before the copy finishes
+            copied.wait();
+            return copied;
+        }
+
+        MemoryPoolUSM& stagingPool = MemoryPoolUSM::getPool(&queue, sycl::usm::alloc::host);
+
+        // All staging buffers are parts of one block, so a failed allocation (std::bad_alloc) leaves nothing behind
+        T* stagingBlock = static_cast<T*>(stagingPool.allocate(stagingBufferCount_ * chunkItems * sizeof(T)));
+
+        std::array<T*, stagingBufferCount_> stagingBuffers;
+        std::array<sycl::event, stagingBufferCount_> stagingEvents;
+        for(uint64_t buffer = 0; buffer < stagingBufferCount_; ++buffer){
+            stagingBuffers[buffer] = stagingBlock + buffer * chunkItems;
+        }
+
+        for(uint64_t first = 0, chunk = 0; first < count; first += chunkItems, ++chunk){
+
+            const uint64_t itemCount = std::min(chunkItems, count - first);
+            const uint64_t buffer = chunk % stagingBufferCount_;
+
+            // Buffer is refilled only after the device copied out what it had
+            stagingEvents[buffer].wait();
+            std::memcpy(stagingBuffers[buffer], source + first, itemCount * sizeof(T));
+
+            stagingEvents[buffer] = queue.memcpy(destination + first, stagingBuffers[buffer], itemCount * sizeof(T), dependency);
+            onChunk(stagingEvents[buffer], first, itemCount);
+        }
+
+        // Earlier copies were waited for before their buffer was refilled, so the last copy of every buffer covers all of
+        // them. Block goes back to the pool after those, the source is not needed anymore.
+        return queue.submit([&](sycl::handler& h){
+            h.depends_on(std::vector<sycl::event>(stagingEvents.begin(), stagingEvents.end()));
+            h.host_task([&stagingPool, stagingBlock](){
+                stagingPool.deallocate(stagingBlock);
+            });
+        });
+    }
+
+    template <class T>
+    /*static*/ sycl::event TransferUSM::upload(sycl::queue& queue, T* destination, const T* source, const uint64_t count,
+    const sycl::event& dependency){
+        return upload(queue, destination, source, count, dependency, [](const sycl::event&, uint64_t, uint64_t){});
+    }
+
+    template <class T, typename F>
+    /*static*/ void TransferUSM::download(sycl::queue& queue, T* destination, const T* source, const uint64_t count,
+    const sycl::event& dependency, F&& onChunk, const uint64_t chunkBytes){
+
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        if(count == 0) return;
+
+        const uint64_t chunkItems = std::max<uint64_t>(1, chunkBytes / sizeof(T));
+
+        if(count <= chunkItems){
+            queue.memcpy(destination, source, count * sizeof(T), dependency).wait();
+            onChunk(uint64_t(0), count);
+            return;
+        }
+
+        MemoryPoolUSM& stagingPool = MemoryPoolUSM::getPool(&queue, sycl::usm::alloc::host);
+
+        // All staging buffers are parts of one block, so a failed allocation (std::bad_alloc) leaves nothing behind
+        T* stagingBlock = static_cast<T*>(stagingPool.allocate(stagingBufferCount_ * chunkItems * sizeof(T)));
+
+        std::array<T*, stagingBufferCount_> stagingBuffers;
+        std::array<sycl::event, stagingBufferCount_> stagingEvents;
+        for(uint64_t buffer = 0; buffer < stagingBufferCount_; ++buffer){
+            stagingBuffers[buffer] = stagingBlock + buffer * chunkItems;
+        }
+
+        const auto submitChunk = [&](const uint64_t first, const uint64_t chunk){
+            const uint64_t buffer = chunk % stagingBufferCount_;
+            stagingEvents[buffer] = queue.memcpy(stagingBuffers[buffer], source + first,
+                std::min(chunkItems, count - first) * sizeof(T), dependency);
+        };
+
+        submitChunk(0, 0);
+
+        for(uint64_t first = 0, chunk = 0; first < count; first += chunkItems, ++chunk){
+
+            // Next chunk goes into the buffer emptied in the previous step, so the device copies it while this one is used
+            if(first + chunkItems < count){
+                submitChunk(first + chunkItems, chunk + 1);
+            }
+
+            const uint64_t itemCount = std::min(chunkItems, count - first);
+            const uint64_t buffer = chunk % stagingBufferCount_;
+
+            stagingEvents[buffer].wait();
+            std::memcpy(destination + first, stagingBuffers[buffer], itemCount * sizeof(T));
+            onChunk(first, itemCount);
+        }
+
+        stagingPool.deallocate(stagingBlock);
+    }
+
+    template <class T>
+    /*static*/ void TransferUSM::download(sycl::queue& queue, T* destination, const T* source, const uint64_t count,
+    const sycl::event& dependency){
+        download(queue, destination, source, count, dependency, [](uint64_t, uint64_t){});
+    }
+}
@@ -9,6 +9,13 @@
 
 namespace gema{
 
+/// Tells elementwise operations of host tensor whether items may be split between threads. With parallel policy the
+/// operation is called from several threads at once, so it must not modify any shared state.
+enum class ExecutionPolicy {
+    sequential,
+    parallel
+};
+
 template<typename T, std::size_t Extent = std::dynamic_extent>
 class span_view : public std::span<const T, Extent> {
     using Base = std::span<const T, Extent>;
@@ -0,0 +1,86 @@
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+
+#define protected public // Hack pro možnost otestovat i privátní funkce
+#include "core/MatrixParallel.hpp"
+#undef protected
+
+using gema::Matrix;
+using gema::MatrixParallel;
+using gema::TensorParallel;
+using gema::LinearContainer;
+
+TEST(matrixparallel_test, matrixMultiplication_001){
+
+    auto matrix = MatrixParallel<int>(2, 3, {1, 2, 3, 4, 5, 6});
+    auto matrix2 = MatrixParallel<int>(3, 2, {7, 8, 9, 10, 11, 12});
+
+    matrix.matrixMultiplication(matrix2);
+
+    auto expected = MatrixParallel<int>(2, 2, {58, 64, 139, 154});
+
+    EXPECT_EQ(matrix, expected);
+}
+
+TEST(matrixparallel_test, matrixMultiplication_002){
+
+    // Sizes that are not multiples of the tile, so partial tiles are used in every dimension
+    const uint64_t m = 37;
+    const uint64_t k = 45;
+    const uint64_t n = 21;
+
+    auto matrix = Matrix<double>(m, k);
+    auto matrix2 = Matrix<double>(k, n);
+
+    for(uint64_t i = 0; i < m * k; ++i){
+        matrix.getData()[i] = static_cast<double>((i * 7) % 13) - 6.0;
+    }
+    for(uint64_t i = 0; i < k * n; ++i){
+        matrix2.getData()[i] = static_cast<double>((i * 5) % 11) / 4.0;
+    }
+
+    auto expected = matrix.matrixMultiplicationAndReturn(matrix2);
+    auto product = MatrixParallel<double>(matrix).matrixMultiplicationAndReturn(MatrixParallel<double>(matrix2)).toMatrix();
+
+    EXPECT_EQ(product.getNumberOfRows(), m);
+    EXPECT_EQ(product.getNumberOfColumns(), n);
+
+    for(uint64_t i = 0; i < m * n; ++i){
+        EXPECT_NEAR(product.getData()[i], expected.getData()[i], 1e-9);
+    }
+}
+
+TEST(matrixparallel_test, transposedMultiplication_001){
+
+    // a is 3 x 2 and b is 4 x 3, so aT * bT is 2 x 4
+    auto a = Matrix<int>(3, 2, {1, 2, 3, 4, 5, 6});
+    auto b = Matrix<int>(4, 3, {1, 0, 2, 0, 1, 1, 3, 1, 0, 2, 2, 2});
+
+    auto expected = a.transpositionAndReturn().matrixMultiplicationAndReturn(b.transpositionAndReturn());
+    auto product = MatrixParallel<int>(a).transposedMultiplicationAndReturn(MatrixParallel<int>(b), true, true);
+
+    EXPECT_EQ(product.toMatrix(), expected);
+
+    // aT * a is 2 x 2
+    auto expected2 = a.transpositionAndReturn().matrixMultiplicationAndReturn(a);
+    auto product2 = MatrixParallel<int>(a).transposedMultiplicationAndReturn(MatrixParallel<int>(a), true, false);
+
+    EXPECT_EQ(product2.toMatrix(), expected2);
+}
+
+TEST(matrixparallel_test, batchedMultiplication_001){
+
+    // Two 2 x 2 matrices multiplied by one shared 2 x 3 matrix
+    auto batch = TensorParallel<int>({2, 2, 2}, {1, 2, 3, 4, 0, 1, 1, 0});
+    auto shared = TensorParallel<int>({2, 3}, {1, 2, 3, 4, 5, 6});
+
+    auto result = MatrixParallel<int>::batchedMultiplicationAndReturn(batch, shared);
+
+    auto expected = TensorParallel<int>({2, 2, 3}, {9, 12, 15, 19, 26, 33, 4, 5, 6, 1, 2, 3});
+
+    EXPECT_EQ(result, expected);
+}
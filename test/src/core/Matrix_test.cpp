@@ -0,0 +1,88 @@
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+
+#define protected public // Hack pro možnost otestovat i privátní funkce
+#include "core/Matrix.hpp"
+#undef protected
+
+using gema::Matrix;
+using gema::LinearContainer;
+
+TEST(matrix_test, constructor_001){
+
+    auto matrix = Matrix<int>(2, 3, {1, 2, 3, 4, 5, 6});
+
+    EXPECT_EQ(matrix.getNumberOfRows(), 2);
+    EXPECT_EQ(matrix.getNumberOfColumns(), 3);
+    EXPECT_EQ(matrix.getItem({1, 0}), 4);
+}
+
+TEST(matrix_test, matrixMultiplication_001){
+
+    auto matrix = Matrix<int>(2, 3, {1, 2, 3, 4, 5, 6});
+    auto matrix2 = Matrix<int>(3, 2, {7, 8, 9, 10, 11, 12});
+
+    matrix.matrixMultiplication(matrix2);
+
+    auto expected = Matrix<int>(2, 2, {58, 64, 139, 154});
+
+    EXPECT_EQ(matrix, expected);
+}
+
+TEST(matrix_test, matrixMultiplication_002){
+
+    // Sizes that are not multiples of any block, so every edge case of packing is used
+    const uint64_t m = 131;
+    const uint64_t k = 300;
+    const uint64_t n = 77;
+
+    auto matrix = Matrix<double>(m, k);
+    auto matrix2 = Matrix<double>(k, n);
+
+    for(uint64_t i = 0; i < m * k; ++i){
+        matrix.getData()[i] = static_cast<double>((i * 7) % 13) - 6.0;
+    }
+    for(uint64_t i = 0; i < k * n; ++i){
+        matrix2.getData()[i] = static_cast<double>((i * 5) % 11) / 4.0;
+    }
+
+    auto product = matrix.matrixMultiplicationAndReturn(matrix2);
+
+    double maxError = 0;
+    for(uint64_t i = 0; i < m; ++i){
+        for(uint64_t j = 0; j < n; ++j){
+
+            double expected = 0;
+            for(uint64_t p = 0; p < k; ++p){
+                expected += matrix.getData()[i * k + p] * matrix2.getData()[p * n + j];
+            }
+
+            maxError = std::max(maxError, std::abs(expected - product.getData()[i * n + j]));
+        }
+    }
+
+    EXPECT_EQ(product.getNumberOfRows(), m);
+    EXPECT_EQ(product.getNumberOfColumns(), n);
+    EXPECT_LT(maxError, 1e-9);
+}
+
+TEST(matrix_test, inverse_001){
+
+    auto matrix = Matrix<double>(3, 3, {0, 2, 1, 1, 3, 2, 1, 0, 0});
+
+    auto identity = matrix.matrixMultiplicationAndReturn(matrix.inverse());
+    auto expected = Matrix<double>(3, 3, {1, 0, 0, 0, 1, 0, 0, 0, 1});
+
+    for(uint64_t i = 0; i < 9; ++i){
+        EXPECT_NEAR(identity.getData()[i], expected.getData()[i], 1e-12);
+    }
+
+    matrix.inverseInPlace();
+    matrix.inverseInPlace();
+
+    EXPECT_NEAR(matrix.getItem({0, 1}), 2, 1e-12);
+}
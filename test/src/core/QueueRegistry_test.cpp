@@ -0,0 +1,92 @@
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+
+#include "core/QueueRegistry.hpp"
+#include "core/TensorParallel.hpp"
+
+using gema::QueueKind;
+using gema::QueueRegistry;
+using gema::TensorParallel;
+using gema::LinearContainer;
+
+TEST(queueregistry_test, getQueue_001){
+
+    // Shared queues are the same for everyone, created ones are always new
+    EXPECT_EQ(QueueRegistry::getQueue(), QueueRegistry::getQueue(QueueKind::inOrder));
+    EXPECT_NE(QueueRegistry::getQueue(QueueKind::outOfOrder), QueueRegistry::getQueue());
+    EXPECT_NE(QueueRegistry::createQueue(), QueueRegistry::createQueue());
+
+    EXPECT_TRUE(QueueRegistry::getQueue()->is_in_order());
+    EXPECT_FALSE(QueueRegistry::getQueue(QueueKind::outOfOrder)->is_in_order());
+    EXPECT_TRUE(QueueRegistry::getQueue(QueueKind::profiling)->has_property<sycl::property::queue::enable_profiling>());
+
+    // Every queue of one device shares the context
+    const sycl::device device = QueueRegistry::getQueue()->get_device();
+    EXPECT_TRUE(QueueRegistry::createQueue(device, QueueKind::outOfOrder)->get_context() == QueueRegistry::getContext(device));
+
+    // Default tensors are on the shared in-order queue
+    EXPECT_EQ(TensorParallel<int>(LinearContainer<uint64_t>{2}).getQueue(), QueueRegistry::getQueue());
+}
+
+TEST(queueregistry_test, getThreadQueue_001){
+
+    constexpr uint64_t threadCount = 4;
+
+    std::vector<sycl::queue*> threadQueues(threadCount);
+    std::vector<int> sums(threadCount);
+    std::vector<std::thread> threads;
+
+    // Every thread computes on its own queue, results stay there
+    for(uint64_t t = 0; t < threadCount; ++t){
+        threads.emplace_back([&, t](){
+
+            sycl::queue* queue = QueueRegistry::getThreadQueue();
+            EXPECT_EQ(QueueRegistry::getThreadQueue(), queue);
+            threadQueues[t] = queue;
+
+            TensorParallel<int> tensor(LinearContainer<uint64_t>{8, 8}, queue);
+            tensor.fillWith(static_cast<int>(t));
+
+            const TensorParallel<int> doubled = tensor + tensor;
+            EXPECT_EQ(doubled.getQueue(), queue);
+            EXPECT_EQ(TensorParallel<int>(doubled).getQueue(), queue);
+
+            sums[t] = doubled.reduce(sycl::plus<int>(), 0);
+        });
+    }
+    for(std::thread& thread : threads){
+        thread.join();
+    }
+
+    for(uint64_t t = 0; t < threadCount; ++t){
+        EXPECT_EQ(sums[t], static_cast<int>(128 * t));
+        for(uint64_t u = 0; u < t; ++u){
+            EXPECT_NE(threadQueues[t], threadQueues[u]);
+        }
+    }
+}
+
+TEST(queueregistry_test, outOfOrder_001){
+
+    sycl::queue* outOfOrderQueue = QueueRegistry::createQueue(QueueKind::outOfOrder);
+    sycl::queue* inOrderQueue = QueueRegistry::createQueue();
+
+    // Kernels on out-of-order queue are ordered by events of the tensors, operands from other queue as well
+    TensorParallel<float> tensor1(LinearContainer<uint64_t>{4, 16}, outOfOrderQueue);
+    TensorParallel<float> tensor2(LinearContainer<uint64_t>{4, 16}, inOrderQueue);
+
+    tensor1.fillWith(1.0f);
+    tensor2.fillWith(2.0f);
+    tensor1.forEach([](float& item){ item *= 3.0f; });
+    tensor1.apply(tensor2, [](float& item1, const float& item2){ item1 += item2; });
+
+    const TensorParallel<float> transposed = tensor1.transpositionAndReturn(0, 1);
+    EXPECT_EQ(transposed.getQueue(), outOfOrderQueue);
+    EXPECT_EQ(transposed.reduce(sycl::plus<float>(), 0.0f), 5.0f * 64);
+    EXPECT_EQ(tensor1.getItem({3, 15}), 5.0f);
+}
@@ -0,0 +1,93 @@
+#include <cstdint>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+
+#include "core/StaticTensor.hpp"
+
+using gema::StaticTensor;
+using gema::StaticShape;
+using gema::DynamicShape;
+using gema::RankedTensor;
+using gema::Tensor;
+using gema::LinearContainer;
+using gema::dynamic_extent;
+
+TEST(statictensor_test, shape_001){
+
+    constexpr StaticShape<2, 3, 4> shape;
+
+    static_assert(shape.rank == 3);
+    static_assert(shape.getNumberOfItems() == 24);
+    static_assert(shape.getIndex({1, 2, 3}) == 23);
+    static_assert(shape.getCoords(17) == std::array<uint64_t, 3>{1, 1, 1});
+
+    const auto shape2 = StaticShape<2, dynamic_extent, 4, dynamic_extent>(5, 6);
+
+    EXPECT_EQ(shape2.getNumberOfItems(), 2 * 5 * 4 * 6);
+    EXPECT_EQ(shape2.extent<1>(), 5);
+    EXPECT_EQ(shape2.extent(3), 6);
+    EXPECT_TRUE(shape2.isValidCoordinates({1, 4, 3, 5}));
+    EXPECT_FALSE(shape2.isValidCoordinates({1, 5, 3, 5}));
+}
+
+TEST(statictensor_test, shape_002){
+
+    // Indices, coordinates and their order are the same as those of Tensor
+    const LinearContainer<uint64_t> dimensionSizes{3, 4, 2, 5};
+    const auto shape = DynamicShape<4>(3, 4, 2, 5);
+
+    std::array<uint64_t, 4> coordinates{};
+    for(uint64_t i = 0; i < shape.getNumberOfItems(); ++i){
+
+        EXPECT_EQ(shape.getIndex(coordinates), i);
+        EXPECT_EQ(shape.getCoords(i), coordinates);
+        EXPECT_EQ(Tensor<int>::getIndex(coordinates, dimensionSizes), i);
+
+        EXPECT_EQ(shape.incrementCoords(coordinates), i + 1 == shape.getNumberOfItems());
+    }
+}
+
+TEST(statictensor_test, getItem_001){
+
+    auto tensor = StaticTensor<int, StaticShape<2, 3>>();
+    tensor.fillWith(0);
+
+    tensor.setItem(5, {1, 0});
+    tensor(0, 2) = 7;
+
+    EXPECT_EQ(tensor.getItem({1, 0}), 5);
+    EXPECT_EQ(tensor.getItem({0, 2}), 7);
+    EXPECT_EQ(tensor.getData()[3], 5);
+    EXPECT_EQ(tensor.getData()[2], 7);
+    EXPECT_EQ(tensor.getNumberOfDimensions(), 2);
+}
+
+TEST(statictensor_test, toTensor_001){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 3, 2};
+    const auto tensor = Tensor<int>(dimensionSizes, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+
+    const auto ranked = RankedTensor<int, 3>(tensor);
+    const auto fixed = StaticTensor<int, StaticShape<2, dynamic_extent, 2>>(tensor);
+
+    EXPECT_EQ(ranked(1, 2, 0), 11);
+    EXPECT_EQ(fixed(1, 2, 0), 11);
+    EXPECT_EQ(ranked.getShape().extent<1>(), 3);
+    EXPECT_EQ(fixed.getDimensionSizes(), (std::array<uint64_t, 3>{2, 3, 2}));
+
+    EXPECT_EQ(ranked.toTensor(), tensor);
+    EXPECT_EQ(fixed.toTensor(), tensor);
+}
+
+TEST(statictensor_test, toTensor_002){
+
+    const auto tensor = Tensor<int>(LinearContainer<uint64_t>{2, 3, 2});
+    const auto flat = Tensor<int>(LinearContainer<uint64_t>{12});
+
+    EXPECT_THROW((StaticTensor<int, StaticShape<2, dynamic_extent, 3>>(tensor)), std::invalid_argument);
+    EXPECT_THROW((RankedTensor<int, 3>(flat)), std::invalid_argument);
+    EXPECT_NO_THROW((StaticTensor<int, StaticShape<dynamic_extent, 3, 2>>(tensor)));
+}
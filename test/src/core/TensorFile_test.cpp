@@ -0,0 +1,146 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+
+#include "core/TensorFile.hpp"
+
+using gema::Tensor;
+using gema::LinearContainer;
+using gema::MemoryBackendMapped;
+
+namespace{
+
+    std::string tensorFilePath(const std::string& name){
+        return (std::filesystem::temp_directory_path() / ("gema_" + name + ".tensor")).string();
+    }
+}
+
+TEST(tensorfile_test, openTensor_001){
+
+    const std::string path = tensorFilePath("openTensor_001");
+
+    const LinearContainer<uint64_t> dimensionSizes{3, 5, 7};
+    Tensor<float> tensor(dimensionSizes);
+    for(uint64_t i = 0; i < tensor.getNumberOfItems(); ++i){
+        tensor.getData()[i] = static_cast<float>(i) * 0.5f;
+    }
+
+    ASSERT_TRUE(gema::saveTensor(path, tensor));
+    EXPECT_TRUE(gema::verifyTensorFile(path));
+
+    const auto header = gema::readTensorFileHeader(path);
+    ASSERT_TRUE(header.has_value());
+    EXPECT_EQ(header->rank, 3);
+    EXPECT_EQ(header->itemCount, 105);
+    EXPECT_EQ(header->dataOffset % 64, 0);
+
+    auto opened = gema::openTensor<float>(path);
+    ASSERT_TRUE(opened.has_value());
+
+    // Items are in the mapped file, aligned like those of ordinary tensor
+    EXPECT_TRUE(opened->getDataContainer().getMemoryBackend().isMapped(opened->getData()));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(opened->getData()) % 64, 0);
+    EXPECT_EQ(opened->getDimensionSizes(), tensor.getDimensionSizes());
+    EXPECT_TRUE(std::equal(tensor.getData(), tensor.getData() + tensor.getNumberOfItems(), opened->getData()));
+    EXPECT_EQ(opened->getItem({2, 4, 6}), tensor.getItem({2, 4, 6}));
+
+    // Copy does not share the file items
+    const Tensor<float, MemoryBackendMapped<float>> copy = *opened;
+    EXPECT_FALSE(copy.getDataContainer().getMemoryBackend().isMapped(copy.getData()));
+    EXPECT_EQ(copy, *opened);
+
+    // Items of other type and damaged files are refused
+    EXPECT_FALSE(gema::openTensor<double>(path).has_value());
+    EXPECT_FALSE(gema::openTensor<float>(tensorFilePath("missing")).has_value());
+
+    std::filesystem::remove(path);
+}
+
+TEST(tensorfile_test, openTensor_002){
+
+    const std::string path = tensorFilePath("openTensor_002");
+
+    const LinearContainer<uint64_t> dimensionSizes{4, 4};
+    Tensor<int> tensor(dimensionSizes);
+    tensor.fillWith(3);
+
+    ASSERT_TRUE(gema::saveTensor(path, tensor));
+
+    // Private mapping keeps the file untouched
+    {
+        auto opened = gema::openTensor<int>(path);
+        ASSERT_TRUE(opened.has_value());
+        opened->setItem(9, {1, 2});
+        EXPECT_EQ(opened->getItem({1, 2}), 9);
+    }
+    EXPECT_EQ(gema::openTensor<int>(path)->getItem({1, 2}), 3);
+
+    // Writable mapping changes the file, which then no longer matches its checksum
+    {
+        auto opened = gema::openTensor<int>(path, true);
+        ASSERT_TRUE(opened.has_value());
+        opened->setItem(9, {1, 2});
+    }
+    EXPECT_EQ(gema::openTensor<int>(path)->getItem({1, 2}), 9);
+    EXPECT_FALSE(gema::verifyTensorFile(path));
+
+    // Truncated file is not valid
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    EXPECT_FALSE(gema::readTensorFileHeader(path).has_value());
+    EXPECT_FALSE(gema::openTensor<int>(path).has_value());
+
+    std::filesystem::remove(path);
+}
+
+TEST(tensorfile_test, openTensor_003){
+
+    const std::string path = tensorFilePath("openTensor_003");
+
+    // No dimensions, single item
+    Tensor<double> tensor{LinearContainer<uint64_t>()};
+    tensor.getData()[0] = 2.5;
+    ASSERT_EQ(tensor.getNumberOfItems(), 1);
+
+    ASSERT_TRUE(gema::saveTensor(path, tensor));
+    EXPECT_TRUE(gema::verifyTensorFile(path));
+
+    const auto header = gema::readTensorFileHeader(path);
+    ASSERT_TRUE(header.has_value());
+    EXPECT_EQ(header->rank, 0);
+    EXPECT_EQ(header->itemCount, 1);
+
+    auto opened = gema::openTensor<double>(path);
+    ASSERT_TRUE(opened.has_value());
+    EXPECT_EQ(opened->getNumberOfDimensions(), 0);
+    EXPECT_EQ(opened->getNumberOfItems(), 1);
+    EXPECT_EQ(opened->getData()[0], 2.5);
+
+    std::filesystem::remove(path);
+}
+
+TEST(tensorfile_test, openTensor_004){
+
+    const std::string path = tensorFilePath("openTensor_004");
+
+    Tensor<int> tensor(LinearContainer<uint64_t>{2, 2});
+    tensor.fillWith(1);
+    ASSERT_TRUE(gema::saveTensor(path, tensor));
+
+    // Product of crafted dimension sizes wraps around to the stored item count
+    {
+        const uint64_t craftedSizes[2] = {(uint64_t(1) << 62) + 1, 4};
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(sizeof(gema::TensorFileHeader));
+        file.write(reinterpret_cast<const char*>(craftedSizes), sizeof(craftedSizes));
+    }
+
+    EXPECT_FALSE(gema::readTensorFileHeader(path).has_value());
+    EXPECT_FALSE(gema::openTensor<int>(path).has_value());
+
+    std::filesystem::remove(path);
+}
@@ -1,5 +1,7 @@
 #include <bitset>
 #include <memory>
+#include <stdexcept>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -12,6 +14,8 @@
 
 using gema::TensorParallel;
 using gema::LinearContainer;
+using gema::MemoryPoolUSM;
+using gema::MemoryPoolStatistics;
 
 // Formatter specializations for certain used types
 namespace std{
@@ -274,10 +278,35 @@ TEST(tensorparallel_test, setItem_003){
 
     auto expected = std::make_unique<TensorParallel<double>>(dimensionSizes);
     expected->setData({2, 3.3, -1, 6.4});
-    
+
     EXPECT_EQ(*tensor, *expected);
 }
 
+TEST(tensorparallel_test, setItems_001){
+
+    const LinearContainer<uint64_t> dimensionSizes{3, 4};
+    auto tensor = TensorParallel<int>(dimensionSizes);
+    tensor.fillWith(0);
+
+    const std::vector<uint64_t> coordinatesList{0, 1, 2, 3, 1, 0, 2, 0};
+    const std::vector<int> values{5, -7, 11, 13};
+
+    tensor.setItems(coordinatesList, values);
+
+    EXPECT_EQ(tensor.getItem({0, 1}), 5);
+    EXPECT_EQ(tensor.getItem({2, 3}), -7);
+    EXPECT_EQ(tensor.getItem({1, 0}), 11);
+    EXPECT_EQ(tensor.getItem({2, 0}), 13);
+    EXPECT_EQ(tensor.getItem({1, 1}), 0);
+
+    const LinearContainer<int> items = tensor.getItems(std::vector<uint64_t>{2, 0, 1, 1, 0, 1});
+
+    ASSERT_EQ(items.size(), 3);
+    EXPECT_EQ(items[0], 13);
+    EXPECT_EQ(items[1], 0);
+    EXPECT_EQ(items[2], 5);
+}
+
 TEST(tensorparallel_test, isEquilateral_001){
 
     const LinearContainer<uint64_t> dimensionSizes{2, 2};
@@ -472,19 +501,134 @@ TEST(tensorparallel_test, transposition_002){
     EXPECT_EQ(tensor, expected);
 }
 
+TEST(tensorparallel_test, transposition_003){
+
+    // Sizes that do not fill whole tiles, every pair of dimensions is swapped
+    const LinearContainer<uint64_t> dimensionSizes{3, 17, 2, 20};
+    const uint64_t itemCount = 3 * 17 * 2 * 20;
+
+    LinearContainer<int> items(itemCount);
+    for(uint64_t i = 0; i < itemCount; ++i){
+        items[i] = static_cast<int>(i);
+    }
+
+    const gema::Tensor<int> hostTensor(dimensionSizes, items);
+
+    for(uint64_t dim1 = 0; dim1 < 4; ++dim1){
+        for(uint64_t dim2 = 0; dim2 < 4; ++dim2){
+
+            const gema::Tensor<int> hostResult = hostTensor.transpositionAndReturn(dim1, dim2);
+
+            LinearContainer<int> expectedItems(itemCount);
+            std::copy_n(hostResult.getData(), itemCount, expectedItems.data());
+            const TensorParallel<int> expected(hostResult.getDimensionSizes(), expectedItems);
+
+            auto tensor = TensorParallel<int>(dimensionSizes, items);
+            const TensorParallel<int> result = tensor.transpositionAndReturn(dim1, dim2);
+            tensor.transposition(dim1, dim2);
+
+            EXPECT_EQ(result, expected) << dim1 << " " << dim2;
+            EXPECT_EQ(tensor, expected) << dim1 << " " << dim2;
+        }
+    }
+}
+
 TEST(tensorparallel_test, resize_001){
 
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
+
+    auto tensor = TensorParallel<int>(dimensionSizes);
+    tensor.setData({1, 2, 3, 4, 5, 6});
+
+    tensor.resize({3, 2});
+
+    auto expected = TensorParallel<int>({3, 2});
+    expected.setData({1, 2, 4, 5, 0, 0});
+
+    EXPECT_EQ(tensor, expected);
+}
+
+TEST(tensorparallel_test, resize_002){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
+
+    auto tensor = TensorParallel<int>(dimensionSizes);
+    tensor.setData({1, 2, 3, 4, 5, 6});
+
+    // Only the first dimension changes, so items stay in place
+    tensor.resize(3, 0);
+
+    auto expected = TensorParallel<int>({3, 3});
+    expected.setData({1, 2, 3, 4, 5, 6, 0, 0, 0});
+
+    EXPECT_EQ(tensor, expected);
+
+    tensor.resize(1, 0);
 
+    auto expected2 = TensorParallel<int>({1, 3});
+    expected2.setData({1, 2, 3});
+
+    EXPECT_EQ(tensor, expected2);
+}
+
+TEST(tensorparallel_test, resize_003){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
+
+    auto tensor = TensorParallel<int>(dimensionSizes);
+    tensor.setData({1, 2, 3, 4, 5, 6});
+
+    // Number of dimensions is changed only by addDimension and removeDimension
+    EXPECT_THROW(tensor.resize(LinearContainer<uint64_t>{6}), std::invalid_argument);
+    EXPECT_THROW(tensor.resize(LinearContainer<uint64_t>{2, 3, 1}), std::invalid_argument);
+
+    auto expected = TensorParallel<int>(dimensionSizes);
+    expected.setData({1, 2, 3, 4, 5, 6});
+
+    EXPECT_EQ(tensor, expected);
 }
 
 TEST(tensorparallel_test, addDimension_001){
 
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
 
+    auto tensor = TensorParallel<int>(dimensionSizes);
+    tensor.setData({1, 2, 3, 4, 5, 6});
+
+    tensor.addDimension(2, 1);
+
+    auto expected = TensorParallel<int>({2, 2, 3});
+    expected.setData({1, 2, 3, 0, 0, 0, 4, 5, 6, 0, 0, 0});
+
+    EXPECT_EQ(tensor, expected);
+
+    tensor.addDimension(2, 0);
+
+    EXPECT_EQ(tensor.getNumberOfItems(), 24);
+    EXPECT_EQ(tensor.getItem({0, 1, 0, 2}), 6);
+    EXPECT_EQ(tensor.getItem({1, 1, 0, 2}), 0);
 }
 
 TEST(tensorparallel_test, removeDimension_001){
 
+    const LinearContainer<uint64_t> dimensionSizes{2, 2, 3};
+
+    auto tensor = TensorParallel<int>(dimensionSizes);
+    tensor.setData({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+
+    tensor.removeDimension(1);
+
+    auto expected = TensorParallel<int>({2, 3});
+    expected.setData({1, 2, 3, 7, 8, 9});
+
+    EXPECT_EQ(tensor, expected);
+
+    tensor.removeDimension(0);
 
+    auto expected2 = TensorParallel<int>({3});
+    expected2.setData({1, 2, 3});
+
+    EXPECT_EQ(tensor, expected2);
 }
 
 TEST(tensorparallel_test, operatorAssign_001){
@@ -675,6 +819,64 @@ TEST(tensorparallel_test, operatorEquals_007){
     EXPECT_EQ(expected, (tensor == tensor2));
 }
 
+TEST(tensorparallel_test, operatorEquals_008){
+
+    // Item count of int16 that does not fill the last word, every tail byte is checked
+    const uint64_t itemCount = 1003;
+    const LinearContainer<uint64_t> dimensionSizes{itemCount};
+
+    auto tensor = TensorParallel<int16_t>(dimensionSizes);
+    tensor.fillWith(7);
+    auto tensor2 = TensorParallel<int16_t>(dimensionSizes);
+    tensor2.fillWith(7);
+
+    EXPECT_TRUE(tensor == tensor2);
+
+    for(const uint64_t index : {uint64_t(0), uint64_t(500), itemCount - 1}){
+
+        tensor2.setItem(8, {index});
+        EXPECT_FALSE(tensor == tensor2);
+
+        tensor2.setItem(7, {index});
+        EXPECT_TRUE(tensor == tensor2);
+    }
+}
+
+TEST(tensorparallel_test, operatorEquals_009){
+
+    // Comparisons from several threads on the same device use their own flags, so every one gets its own result
+    const LinearContainer<uint64_t> dimensionSizes{1000};
+
+    auto tensor = TensorParallel<int>(dimensionSizes);
+    tensor.fillWith(1);
+    auto same = TensorParallel<int>(dimensionSizes);
+    same.fillWith(1);
+    auto different = TensorParallel<int>(dimensionSizes);
+    different.fillWith(1);
+    different.setItem(2, {999});
+
+    std::vector<int> results(8, -1);
+    std::vector<std::thread> threads;
+
+    for(uint64_t t = 0; t < results.size(); ++t){
+        threads.emplace_back([&, t](){
+            bool correct = true;
+            for(int i = 0; i < 20; ++i){
+                correct = correct && (tensor == (t % 2 == 0 ? same : different)) == (t % 2 == 0);
+            }
+            results[t] = correct;
+        });
+    }
+
+    for(std::thread& thread : threads){
+        thread.join();
+    }
+
+    for(const int result : results){
+        EXPECT_EQ(result, 1);
+    }
+}
+
 // (+) ------------------------------------------------------------------------------------------------------------------------
 
 TEST(tensorparallel_test, operatorAdd_001){
@@ -2430,6 +2632,92 @@ TEST(tensorparallel_test, forEach_002){
     EXPECT_EQ(tensor, expected);
 }
 
+TEST(tensorparallel_test, forEachWithCoords_001){
+
+    const LinearContainer<uint64_t> dimensionSizes{3, 4, 5};
+
+    auto tensor = TensorParallel<int>(dimensionSizes);
+    EXPECT_TRUE(tensor.forEachWithCoords([](int& item, gema::span_view<uint64_t> coords){
+        item = static_cast<int>(coords[0] * 100 + coords[1] * 10 + coords[2]);
+    }));
+
+    auto expected = gema::Tensor<int>(dimensionSizes);
+    expected.forEachWithCoords([](int& item, gema::span_view<uint64_t> coords){
+        item = static_cast<int>(coords[0] * 100 + coords[1] * 10 + coords[2]);
+    });
+
+    EXPECT_EQ(tensor, TensorParallel<int>(dimensionSizes, expected.getDataContainer()));
+
+    // Only items of the box are changed, with coordinates of the whole tensor
+    EXPECT_TRUE(tensor.forEachWithCoords([](int& item, gema::span_view<uint64_t> coords){
+        item = -static_cast<int>(coords.size() + coords[2]);
+    }, {1, 1, 2}, {3, 3, 5}));
+
+    expected.forEachWithCoords([](int& item, gema::span_view<uint64_t> coords){
+        item = -static_cast<int>(coords.size() + coords[2]);
+    }, {1, 1, 2}, {3, 3, 5});
+
+    EXPECT_EQ(tensor, TensorParallel<int>(dimensionSizes, expected.getDataContainer()));
+    EXPECT_EQ(tensor.getItem({2, 2, 4}), -7);
+    EXPECT_EQ(tensor.getItem({1, 1, 1}), 111);
+
+    EXPECT_FALSE(tensor.forEachWithCoords([](int& item, gema::span_view<uint64_t>){ item = 0; }, {0, 0, 0}, {4, 4, 5}));
+    EXPECT_EQ(tensor.getItem({0, 0, 0}), 0);
+    EXPECT_EQ(tensor.getItem({2, 3, 4}), 234);
+}
+
+TEST(tensorparallel_test, forEachWithCoords_002){
+
+    // More dimensions than fit into private memory of the kernel, every work-item walks several items
+    LinearContainer<uint64_t> dimensionSizes(18);
+    std::fill(dimensionSizes.begin(), dimensionSizes.end(), 2);
+    dimensionSizes[17] = 3;
+
+    // The same callable for host and parallel tensor
+    const auto encode = [](int& item, gema::span_view<uint64_t> coords){
+        int code = 0;
+        for(uint64_t d = 0; d < coords.size(); ++d){
+            code = code * 3 + static_cast<int>(coords[d]);
+        }
+        item = code;
+    };
+
+    auto tensor = TensorParallel<int>(dimensionSizes);
+    EXPECT_TRUE(tensor.forEachWithCoords(encode));
+
+    auto expected = gema::Tensor<int>(dimensionSizes);
+    expected.forEachWithCoords(encode);
+
+    EXPECT_EQ(tensor, TensorParallel<int>(dimensionSizes, expected.getDataContainer()));
+
+    LinearContainer<uint64_t> boxBegin(18);
+    std::fill(boxBegin.begin(), boxBegin.end(), 0);
+    boxBegin[0] = 1;
+    boxBegin[17] = 1;
+
+    const auto negate = [](int& item, gema::span_view<uint64_t>){ item = -item; };
+    const gema::span_view<uint64_t> begin(boxBegin);
+    const gema::span_view<uint64_t> end(dimensionSizes);
+
+    EXPECT_TRUE(tensor.forEachWithCoords(negate, begin, end));
+    EXPECT_TRUE(expected.forEachWithCoords(negate, begin, end));
+
+    EXPECT_EQ(tensor, TensorParallel<int>(dimensionSizes, expected.getDataContainer()));
+    EXPECT_FALSE(tensor.forEachWithCoords(negate, end, begin));
+}
+
+TEST(tensorparallel_test, forEachWithCoords_003){
+
+    // Tensor without dimensions has one item at empty coordinates
+    auto tensor = TensorParallel<int>(LinearContainer<uint64_t>{});
+    tensor.fillWith(4);
+
+    EXPECT_TRUE(tensor.forEachWithCoords([](int& item, gema::span_view<uint64_t> coords){
+        item += static_cast<int>(coords.size()) + 1;
+    }));
+    EXPECT_EQ(tensor.getHostItems(), (LinearContainer<int>{5}));
+}
+
 // TEST(tensorparallel_test, forEach_003){
 
 //     const LinearContainer<uint64_t> dimensionSizes{2};
@@ -2499,6 +2787,399 @@ TEST(tensorparallel_test, forEach_002){
     
 // }
 
+TEST(tensorparallel_test, operatorChain_001){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
+
+    auto tensor = TensorParallel<int>(dimensionSizes);
+    tensor.setData({1, 2, 3, 4, 5, 6});
+
+    auto tensor2 = TensorParallel<int>(dimensionSizes);
+    tensor2.setData({2, 0, -1, 3, 1, -2});
+
+    auto tensor3 = TensorParallel<int>(dimensionSizes);
+    tensor3.setData({1, 1, 1, 1, 1, 1});
+
+    auto tensor4 = TensorParallel<int>(dimensionSizes);
+    tensor4.setData({0, 1, 2, 3, 4, 5});
+
+    auto expected = TensorParallel<int>(dimensionSizes);
+    expected.setData({3, 0, -4, 10, 2, -16});
+
+    TensorParallel<int> result = tensor * tensor2 + tensor3 - tensor4;
+
+    EXPECT_EQ(result, expected);
+}
+
+TEST(tensorparallel_test, operatorChain_002){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
+
+    auto tensor = TensorParallel<int>(dimensionSizes);
+    tensor.setData({1, 2, 3, 4, 5, 6});
+
+    auto tensor2 = TensorParallel<int>(dimensionSizes);
+    tensor2.setData({2, 0, -1, 3, 1, -2});
+
+    auto expected = TensorParallel<int>(dimensionSizes);
+    expected.setData({6, 6, 5, -1, -1, 0});
+
+    TensorParallel<int> result = -(tensor * 2) + 10 - tensor2;
+
+    EXPECT_EQ(result, expected);
+
+    // Expression reading the tensor it is assigned to
+    expected.setData({3, 4, 8, 19, 26, 34});
+
+    tensor = tensor * tensor + tensor2;
+
+    EXPECT_EQ(tensor, expected);
+}
+
+TEST(tensorparallel_test, operatorChain_003){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
+
+    auto tensor = TensorParallel<int>(dimensionSizes);
+    tensor.setData({1, 2, 3, 4, 5, 6});
+
+    auto tensor2 = TensorParallel<int>(dimensionSizes);
+    tensor2.setData({2, 0, -1, 3, 1, -2});
+
+    auto tensor3 = TensorParallel<int>(dimensionSizes);
+    tensor3.setData({1, 1, 1, 1, 1, 1});
+
+    auto expected = TensorParallel<int>(dimensionSizes);
+    expected.setData({3, 2, 2, 7, 6, 4});
+
+    tensor += tensor2 * tensor3;
+
+    EXPECT_EQ(tensor, expected);
+}
+
+TEST(tensorparallel_test, operatorChain_004){
+
+    auto tensor = TensorParallel<int>(LinearContainer<uint64_t>{2, 3});
+    tensor.setData({1, 2, 3, 4, 5, 6});
+
+    auto transposed = TensorParallel<int>(LinearContainer<uint64_t>{3, 2});
+    transposed.setData({1, 1, 1, 1, 1, 1});
+
+    // Same number of items, but different shape is refused
+    EXPECT_THROW(TensorParallel<int> result = tensor + transposed, std::invalid_argument);
+    EXPECT_THROW(tensor = tensor + transposed, std::invalid_argument);
+
+    // Only expressions over TensorParallel can reach kernels
+    static_assert(gema::expression_over_v<TensorParallel, decltype(tensor * 2 + transposed)>);
+    static_assert(!gema::expression_over_v<TensorParallel, decltype(gema::Tensor<int>(LinearContainer<uint64_t>{2}) * 2)>);
+
+    transposed = tensor * 2;
+    EXPECT_EQ(transposed.getDimensionSizes()[0], 2);
+    EXPECT_EQ(transposed.getItem({1, 2}), 12);
+}
+
+TEST(tensorparallel_test, sync_001){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
+
+    auto tensor = TensorParallel<int>(dimensionSizes);
+    tensor.setData({1, 2, 3, 4, 5, 6});
+
+    auto tensor2 = TensorParallel<int>(dimensionSizes);
+    tensor2.setData({2, 0, -1, 3, 1, -2});
+
+    // Chain of kernels submitted without waiting
+    for(int i = 0; i < 10; ++i){
+        tensor += tensor2;
+        tensor2.forEach([](int& item){
+            item *= -1;
+        });
+    }
+
+    tensor.sync();
+    tensor2.sync();
+
+    auto expected = TensorParallel<int>(dimensionSizes);
+    expected.setData({1, 2, 3, 4, 5, 6});
+
+    EXPECT_EQ(tensor, expected);
+    EXPECT_EQ(tensor2.getItem({1, 2}), -2);
+}
+
+TEST(tensorparallel_test, reduce_001){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
+
+    auto tensor = TensorParallel<int>(dimensionSizes);
+    tensor.setData({1, -2, 3, 4, 5, -6});
+
+    EXPECT_EQ(tensor.reduce(sycl::plus<int>(), 10), 15);
+    EXPECT_EQ(tensor.reduce(sycl::minimum<int>(), 0), -6);
+    EXPECT_EQ(tensor.reduce([](const int& a, const int& b){ return sycl::max(sycl::abs(a), sycl::abs(b)); }, 0), 6);
+
+    // Reductions with known identity only recycle shared memory of the pool
+    const MemoryPoolStatistics before = MemoryPoolUSM::getPool(tensor.getQueue(), sycl::usm::alloc::shared).getStatistics();
+    for(int i = 0; i < 4; ++i){
+        EXPECT_EQ(tensor.reduce(sycl::plus<int>(), i), 5 + i);
+    }
+    const MemoryPoolStatistics after = MemoryPoolUSM::getPool(tensor.getQueue(), sycl::usm::alloc::shared).getStatistics();
+    EXPECT_EQ(after.misses, before.misses);
+    EXPECT_EQ(after.hits, before.hits + 4);
+}
+
+TEST(tensorparallel_test, reduce_002){
+
+    const LinearContainer<uint64_t> dimensionSizes{10, 1000};
+
+    auto tensor = TensorParallel<int>(dimensionSizes);
+    tensor.fillWith(3);
+
+    EXPECT_EQ(tensor.reduce([](const int& a, const int& b){ return a + b; }, 1), 30001);
+}
+
+TEST(tensorparallel_test, reduce_003){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
+
+    auto tensor = TensorParallel<int>(dimensionSizes);
+    tensor.setData({1, -2, 3, 4, 5, -6});
+
+    auto tensor2 = tensor;
+
+    auto expected = TensorParallel<int>({3});
+    expected.setData({6, 4, -2});
+
+    tensor.reduce(0, sycl::plus<int>(), 1);
+
+    EXPECT_EQ(tensor, expected);
+
+    auto expected2 = TensorParallel<int>({2});
+    expected2.setData({2, 3});
+
+    tensor2.reduce(1, sycl::plus<int>(), 0);
+
+    EXPECT_EQ(tensor2, expected2);
+}
+
+TEST(tensorparallel_test, reduce_004){
+
+    // Operations keeping one of the operands are associative, but not commutative, so items have to be combined in order
+    for(const uint64_t itemCount : {1, 2, 15, 16, 17, 1000, 65537, 1000003}){
+
+        LinearContainer<int> items(itemCount);
+        for(uint64_t i = 0; i < itemCount; ++i){
+            items[i] = static_cast<int>(i);
+        }
+
+        auto tensor = TensorParallel<int>({itemCount});
+        tensor.setData(items);
+
+        EXPECT_EQ(tensor.reduce([](const int&, const int& b){ return b; }, -1), static_cast<int>(itemCount - 1));
+        EXPECT_EQ(tensor.reduce([](const int& a, const int&){ return a; }, -1), -1);
+    }
+}
+
+TEST(tensorparallel_test, collapseDimension_001){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
+
+    auto tensor = TensorParallel<int>(dimensionSizes);
+    tensor.setData({1, -2, 3, 4, 5, -6});
+
+    auto expected = TensorParallel<int>({2});
+    expected.setData({-6, -120});
+
+    tensor.collapseDimension(1, [](int& accumulated, const int& item){
+        accumulated *= item;
+    });
+
+    EXPECT_EQ(tensor, expected);
+}
+
+TEST(tensorparallel_test, memoryPool_001){
+
+    const LinearContainer<uint64_t> dimensionSizes{64, 64};
+
+    auto tensor = TensorParallel<int>(dimensionSizes);
+    MemoryPoolUSM& pool = MemoryPoolUSM::getPool(tensor.getQueue(), sycl::usm::alloc::device);
+
+    pool.trim();
+    const MemoryPoolStatistics before = pool.getStatistics();
+
+    // Temporaries of the same size reuse the block freed by the previous one
+    for(int i = 0; i < 4; ++i){
+        auto temporary = TensorParallel<int>(dimensionSizes);
+        temporary.fillWith(i);
+    }
+
+    const MemoryPoolStatistics after = pool.getStatistics();
+
+    EXPECT_GE(after.hits - before.hits, 3);
+    EXPECT_LE(after.misses - before.misses, 1);
+    EXPECT_GE(after.highWater, 2 * 64 * 64 * sizeof(int));
+    EXPECT_GT(after.bytesCached, 0);
+
+    pool.trim();
+
+    EXPECT_EQ(pool.getStatistics().bytesCached, 0);
+    EXPECT_EQ(MemoryPoolUSM::getSizeClass(1), 256);
+    EXPECT_EQ(MemoryPoolUSM::getSizeClass(1025), 1280);
+
+    // Pools belong to context and device, not to the queue, so every queue of the registry shares them
+    sycl::queue* otherQueue = gema::QueueRegistry::createQueue(tensor.getQueue()->get_device());
+    if(otherQueue->get_context() == tensor.getQueue()->get_context()){
+        EXPECT_EQ(&MemoryPoolUSM::getPool(otherQueue, sycl::usm::alloc::device), &pool);
+    }
+    EXPECT_NE(&MemoryPoolUSM::getPool(otherQueue, sycl::usm::alloc::host), &pool);
+}
+
+TEST(tensorparallel_test, threeWayComparison_001){
+
+    // More items than one work-group, differences in several groups
+    const uint64_t itemCount = 1000;
+    const LinearContainer<uint64_t> dimensionSizes{itemCount};
+
+    LinearContainer<float> items(itemCount);
+    for(uint64_t i = 0; i < itemCount; ++i){
+        items[i] = static_cast<float>(i);
+    }
+
+    auto tensor = TensorParallel<float>(dimensionSizes, items);
+
+    items[700] = -1.0f;
+    items[300] = 1000.0f;
+    auto tensor2 = TensorParallel<float>(dimensionSizes, items);
+
+    items[300] = 300.0f;
+    auto tensor3 = TensorParallel<float>(dimensionSizes, items);
+
+    auto tensor4 = TensorParallel<float>(LinearContainer<uint64_t>{10, 100}, items);
+
+    tensor.sync();
+    tensor2.sync();
+    tensor3.sync();
+    tensor4.sync();
+
+    EXPECT_EQ(tensor.getTensor() <=> tensor.getTensor(), std::partial_ordering::equivalent);
+    EXPECT_EQ(tensor.getTensor() <=> tensor2.getTensor(), std::partial_ordering::less);
+    EXPECT_EQ(tensor2.getTensor() <=> tensor.getTensor(), std::partial_ordering::greater);
+    EXPECT_EQ(tensor.getTensor() <=> tensor3.getTensor(), std::partial_ordering::greater);
+    EXPECT_EQ(tensor.getTensor() <=> tensor4.getTensor(), std::partial_ordering::unordered);
+}
+
+TEST(tensorparallel_test, hostMirror_001){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
+    auto tensor = TensorParallel<int>(dimensionSizes, LinearContainer<int>{0, 1, 2, 3, 4, 5});
+
+    tensor.setHostMirror(true);
+    EXPECT_TRUE(tensor.hasHostMirror());
+    EXPECT_EQ(tensor.getItem({1, 2}), 5);
+
+    // Item changed behind the back of the tensor is not seen, so the mirror was not copied again
+    const int hidden = 50;
+    tensor.getQueue()->memcpy(const_cast<int*>(std::as_const(tensor).getData()) + 5, &hidden, sizeof(int)).wait();
+    EXPECT_EQ(tensor.getItem({1, 2}), 5);
+    EXPECT_EQ(tensor.toString(), "{{0, 1, 2}, {3, 4, 5}}");
+
+    // Writes from host go through the mirror, kernels make it stale
+    tensor.setItem(-3, {1, 0});
+    EXPECT_EQ(tensor.getItem({1, 0}), -3);
+    EXPECT_EQ(tensor.getItems(LinearContainer<uint64_t>{1, 0, 0, 1}), (LinearContainer<int>{-3, 1}));
+
+    tensor.forEach([](int& item){ item += 1; });
+    EXPECT_EQ(tensor.getItem({1, 2}), 51);
+    EXPECT_EQ(tensor.getHostItems(), (LinearContainer<int>{1, 2, 3, -2, 5, 51}));
+
+    tensor.transposition();
+    EXPECT_EQ(tensor.getItem({2, 1}), 51);
+    EXPECT_EQ(tensor.toString(), "{{1, -2}, {2, 5}, {3, 51}}");
+
+    // Copy keeps the setting, turning it off reads device again
+    EXPECT_TRUE(TensorParallel<int>(tensor).hasHostMirror());
+    tensor.setHostMirror(false);
+    EXPECT_EQ(tensor.getItem({0, 1}), -2);
+}
+
+TEST(tensorparallel_test, hostMirror_002){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 2};
+    auto mirrored = TensorParallel<int>(dimensionSizes, LinearContainer<int>{1, 2, 3, 4});
+    mirrored.setHostMirror(true);
+    EXPECT_EQ(mirrored.getItem({0, 1}), 2);
+
+    // Assignment takes the setting both ways
+    auto plain = TensorParallel<int>(dimensionSizes);
+    plain = mirrored;
+    EXPECT_TRUE(plain.hasHostMirror());
+    EXPECT_EQ(plain.getHostItems(), (LinearContainer<int>{1, 2, 3, 4}));
+
+    auto mirroredToo = mirrored;
+    mirroredToo = TensorParallel<int>(LinearContainer<uint64_t>{3});
+    EXPECT_FALSE(mirroredToo.hasHostMirror());
+
+    const TensorParallel<int> unmirrored(LinearContainer<uint64_t>{3});
+    plain = unmirrored;
+    EXPECT_FALSE(plain.hasHostMirror());
+    EXPECT_EQ(plain.getItem({2}), 0);
+
+    // Move assignment takes the valid mirror, so item changed behind the back of the tensor is not seen
+    const int hidden = 50;
+    mirrored.getQueue()->memcpy(const_cast<int*>(std::as_const(mirrored).getData()) + 1, &hidden, sizeof(int)).wait();
+
+    auto moved = TensorParallel<int>(dimensionSizes);
+    moved = std::move(mirrored);
+    EXPECT_TRUE(moved.hasHostMirror());
+    EXPECT_EQ(moved.getItem({0, 1}), 2);
+
+    // Kernel makes it stale again
+    moved.forEach([](int& item){ item += 1; });
+    EXPECT_EQ(moved.getItem({0, 1}), 51);
+}
+
+TEST(tensorparallel_test, hostMirror_003){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
+    auto tensor = TensorParallel<int>(dimensionSizes, LinearContainer<int>{0, 1, 2, 3, 4, 5});
+    tensor.setHostMirror(true);
+    EXPECT_EQ(tensor.getItem({1, 2}), 5);
+
+    // Operations replacing the items keep the setting and do not show the old mirror
+    tensor.reduce(0, sycl::plus<int>(), 0);
+    EXPECT_TRUE(tensor.hasHostMirror());
+    EXPECT_EQ(tensor.getHostItems(), (LinearContainer<int>{3, 5, 7}));
+
+    auto matrix = TensorParallel<int>(dimensionSizes, LinearContainer<int>{0, 1, 2, 3, 4, 5});
+    matrix.setHostMirror(true);
+    EXPECT_EQ(matrix.getItem({0, 0}), 0);
+    matrix.collapseDimension(1, [](int& a, const int& b){ a += b; });
+    EXPECT_TRUE(matrix.hasHostMirror());
+    EXPECT_EQ(matrix.getHostItems(), (LinearContainer<int>{3, 12}));
+
+    const auto other = TensorParallel<int>(dimensionSizes, LinearContainer<int>{1, 1, 1, 1, 1, 1});
+    tensor = other + other;
+    EXPECT_TRUE(tensor.hasHostMirror());
+    EXPECT_EQ(tensor.getItem({1, 2}), 2);
+}
+
+TEST(tensorparallel_test, hostMirror_004){
+
+    auto tensor = TensorParallel<int>(LinearContainer<uint64_t>{4}, LinearContainer<int>{0, 1, 2, 3});
+    tensor.setHostMirror(true);
+    EXPECT_EQ(tensor.getItem({2}), 2);
+
+    // Mirror shows the same value as device even when coordinates are given more than once
+    const LinearContainer<uint64_t> coordinates{2, 1, 2, 2};
+    const LinearContainer<int> values{10, 20, 30, 40};
+    tensor.setItems(coordinates, values);
+
+    const int mirrored = tensor.getItem({2});
+    EXPECT_EQ(tensor.getItem({1}), 20);
+
+    tensor.setHostMirror(false);
+    EXPECT_EQ(tensor.getItem({2}), mirrored);
+}
+
 TEST(tensorparallel_test, showDebug){
 
     const LinearContainer<uint64_t> dimensionSizes{2, 3};
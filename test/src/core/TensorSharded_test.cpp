@@ -0,0 +1,153 @@
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+
+#include "core/TensorSharded.hpp"
+
+using gema::Tensor;
+using gema::TensorParallel;
+using gema::TensorSharded;
+using gema::LinearContainer;
+
+namespace{
+
+    // Items 0, 1, 2 ... itemCount - 1
+    LinearContainer<int> makeItems(const uint64_t itemCount){
+
+        LinearContainer<int> items(itemCount);
+        for(uint64_t i = 0; i < itemCount; ++i){
+            items[i] = static_cast<int>(i);
+        }
+        return items;
+    }
+}
+
+TEST(tensorsharded_test, constructor_001){
+
+    sycl::queue queue1{sycl::property::queue::in_order{}};
+    sycl::queue queue2{sycl::property::queue::in_order{}};
+    sycl::queue queue3{sycl::property::queue::in_order{}};
+    const std::vector<sycl::queue*> queues{&queue1, &queue2, &queue3};
+
+    const LinearContainer<uint64_t> dimensionSizes{7, 2, 3};
+    TensorSharded<int> tensor(dimensionSizes, makeItems(42), queues);
+
+    // First dimension 7 is split into 3, 2 and 2
+    ASSERT_EQ(tensor.getShardCount(), 3);
+    EXPECT_EQ(tensor.getShardBegin(1), 3);
+    EXPECT_EQ(tensor.getShardBegin(2), 5);
+    EXPECT_EQ(tensor.getShard(0).getDimensionSizes()[0], 3);
+    EXPECT_EQ(tensor.getShard(2).getDimensionSizes()[0], 2);
+    EXPECT_EQ(tensor.getShard(2).getNumberOfItems(), 12);
+    EXPECT_EQ(tensor.getShard(1).getQueue(), &queue2);
+    EXPECT_EQ(tensor.getNumberOfItems(), 42);
+
+    EXPECT_EQ(tensor.getItem({0, 0, 0}), 0);
+    EXPECT_EQ(tensor.getItem({4, 1, 2}), 29);
+    EXPECT_EQ(tensor.getItem({6, 1, 2}), 41);
+
+    tensor.setItem(-1, {5, 0, 1});
+    EXPECT_EQ(tensor.getShard(2).getItem({0, 0, 1}), -1);
+
+    // Gather and scatter keep the items
+    const TensorParallel<int> gathered = tensor.gather(&queue1);
+    EXPECT_EQ(gathered.getNumberOfItems(), 42);
+    EXPECT_EQ(tensor.gatherToHost().getItem({5, 0, 1}), -1);
+    EXPECT_EQ(TensorSharded<int>::scatter(gathered, queues), tensor);
+    EXPECT_EQ(tensor.toString(), gathered.toString());
+
+    // Shorter first dimension than number of queues leaves empty shards
+    TensorSharded<int> shortTensor(LinearContainer<uint64_t>{2, 3}, makeItems(6), queues);
+    EXPECT_EQ(shortTensor.getShard(2).getNumberOfItems(), 0);
+    EXPECT_EQ(shortTensor.getItem({1, 2}), 5);
+}
+
+TEST(tensorsharded_test, elementwise_001){
+
+    sycl::queue queue1{sycl::property::queue::in_order{}};
+    sycl::queue queue2{sycl::property::queue::in_order{}};
+    const std::vector<sycl::queue*> queues{&queue1, &queue2};
+
+    const LinearContainer<uint64_t> dimensionSizes{5, 4};
+    TensorSharded<int> tensor1(dimensionSizes, makeItems(20), queues);
+    TensorSharded<int> tensor2(dimensionSizes, queues);
+    tensor2.fillWith(10);
+
+    tensor1.forEach([](int& item){ item *= 2; });
+    tensor1.apply(tensor2, [](int& item1, const int& item2){ item1 += item2; });
+
+    const TensorSharded<int> sum = tensor1.applyAndReturn(tensor2, [](const int& item1, const int& item2){ return item1 + item2; });
+    const TensorSharded<int> halves = sum.forEachAndReturn([](const int& item){ return item / 2; });
+
+    const Tensor<int> sumItems = sum.gatherToHost();
+    const Tensor<int> halvesItems = halves.gatherToHost();
+    for(uint64_t i = 0; i < 20; ++i){
+        EXPECT_EQ(sumItems.getData()[i], static_cast<int>(2 * i + 20));
+        EXPECT_EQ(halvesItems.getData()[i], static_cast<int>(i + 10));
+    }
+}
+
+TEST(tensorsharded_test, exchange_001){
+
+    sycl::queue queue1{sycl::property::queue::in_order{}};
+    sycl::queue queue2{sycl::property::queue::in_order{}};
+    sycl::queue queue3{sycl::property::queue::in_order{}};
+    const std::vector<sycl::queue*> queues{&queue1, &queue2, &queue3};
+
+    const LinearContainer<uint64_t> dimensionSizes{4, 3, 2};
+    const TensorParallel<int> single(dimensionSizes, makeItems(24));
+    const TensorSharded<int> tensor(dimensionSizes, makeItems(24), queues);
+
+    // Init is combined only once with known identity and without it
+    EXPECT_EQ(tensor.reduce(sycl::plus<int>(), 100), 100 + 23 * 24 / 2);
+    EXPECT_EQ(tensor.reduce([](const int& a, const int& b){ return a + b; }, 100), 100 + 23 * 24 / 2);
+    EXPECT_EQ(tensor.reduce(sycl::maximum<int>(), -1), 23);
+
+    // Transpositions with and without the first dimension match those of single tensor
+    EXPECT_EQ(tensor.transpositionAndReturn(1, 2).gather(&queue1), single.transpositionAndReturn(1, 2));
+    EXPECT_EQ(tensor.transpositionAndReturn(0, 2).gather(&queue1), single.transpositionAndReturn(0, 2));
+
+    TensorSharded<int> transposed = tensor;
+    transposed.transposition(0, 1);
+    EXPECT_EQ(transposed.getDimensionSizes(), (LinearContainer<uint64_t>{3, 4, 2}));
+    EXPECT_EQ(transposed.getShard(0).getDimensionSizes()[0], 1);
+
+    // Reductions of dimension
+    for(const uint64_t dimensionIndex : {0, 2}){
+
+        TensorSharded<int> reduced = tensor;
+        reduced.reduce(dimensionIndex, sycl::plus<int>(), 1);
+
+        TensorParallel<int> singleReduced = single;
+        singleReduced.reduce(dimensionIndex, sycl::plus<int>(), 1);
+
+        EXPECT_EQ(reduced.gather(&queue1), singleReduced);
+    }
+}
+
+TEST(tensorsharded_test, exchange_002){
+
+    sycl::queue queue1{sycl::property::queue::in_order{}};
+    sycl::queue queue2{sycl::property::queue::in_order{}};
+    const std::vector<sycl::queue*> queues{&queue1, &queue2};
+
+    EXPECT_THROW((TensorSharded<int>(LinearContainer<uint64_t>{4}, {})), std::invalid_argument);
+
+    // Reduction of the only dimension leaves single item, which is kept whole on the first queue
+    TensorSharded<int> tensor(LinearContainer<uint64_t>{5}, makeItems(5), queues);
+    tensor.reduce(0, sycl::plus<int>(), 1);
+
+    EXPECT_EQ(tensor.getDimensionSizes().size(), 0);
+    ASSERT_EQ(tensor.getShardCount(), 1);
+    EXPECT_EQ(tensor.getShard(0).getQueue(), &queue1);
+    EXPECT_EQ(tensor.getNumberOfItems(), 1);
+    EXPECT_EQ(tensor.getItem({}), 11);
+    EXPECT_EQ(tensor.gatherToHost().getData()[0], 11);
+
+    tensor.setItem(3, {});
+    EXPECT_EQ(tensor.reduce(sycl::plus<int>(), 0), 3);
+}
@@ -0,0 +1,112 @@
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+
+#include "core/TensorStream.hpp"
+
+using gema::Tensor;
+using gema::LinearContainer;
+using gema::TensorFileReader;
+using gema::TensorFileWriter;
+
+namespace{
+
+    std::string tensorStreamPath(const std::string& name){
+        return (std::filesystem::temp_directory_path() / ("gema_" + name + ".tensor")).string();
+    }
+
+    Tensor<int> makeSlab(const uint64_t first, const uint64_t count){
+
+        Tensor<int> slab(LinearContainer<uint64_t>{count, 3, 4});
+        for(uint64_t i = 0; i < slab.getNumberOfItems(); ++i){
+            slab.getData()[i] = static_cast<int>(first * 12 + i);
+        }
+        return slab;
+    }
+}
+
+TEST(tensorstream_test, writeSlab_001){
+
+    const std::string path = tensorStreamPath("writeSlab_001");
+
+    // Slabs of 4, 4 and 2 make tensor with items 0 ... 119
+    {
+        TensorFileWriter<int> writer(path, {10, 3, 4});
+        ASSERT_TRUE(writer.isOpen());
+
+        EXPECT_TRUE(writer.writeSlab(makeSlab(0, 4)));
+        EXPECT_TRUE(writer.writeSlab(makeSlab(4, 4)));
+
+        // Slab of other shape or one not fitting into the tensor is refused
+        EXPECT_FALSE(writer.writeSlab(Tensor<int>(LinearContainer<uint64_t>{2, 4, 3})));
+        EXPECT_FALSE(writer.writeSlab(makeSlab(8, 3)));
+
+        EXPECT_TRUE(writer.writeSlab(makeSlab(8, 2)));
+        EXPECT_TRUE(writer.close());
+    }
+
+    EXPECT_TRUE(gema::verifyTensorFile(path));
+
+    const auto opened = gema::openTensor<int>(path);
+    ASSERT_TRUE(opened.has_value());
+    EXPECT_EQ(opened->getDimensionSizes(), (LinearContainer<uint64_t>{10, 3, 4}));
+    for(uint64_t i = 0; i < 120; ++i){
+        EXPECT_EQ(opened->getData()[i], static_cast<int>(i));
+    }
+
+    // File written at once is the same
+    const std::string wholePath = tensorStreamPath("writeSlab_001_whole");
+    ASSERT_TRUE(gema::saveTensor(wholePath, makeSlab(0, 10)));
+    EXPECT_EQ(gema::readTensorFileHeader(wholePath)->checksum, gema::readTensorFileHeader(path)->checksum);
+
+    // Unfinished file is reported
+    {
+        TensorFileWriter<int> writer(path, {10, 3, 4});
+        EXPECT_TRUE(writer.writeSlab(makeSlab(0, 4)));
+        EXPECT_FALSE(writer.close());
+    }
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(wholePath);
+}
+
+TEST(tensorstream_test, forEachSlab_001){
+
+    const std::string path = tensorStreamPath("forEachSlab_001");
+    ASSERT_TRUE(gema::saveTensor(path, makeSlab(0, 10)));
+
+    TensorFileReader<int> reader(path);
+    ASSERT_TRUE(reader.isOpen());
+    EXPECT_FALSE(TensorFileReader<float>(path).isOpen());
+
+    std::vector<uint64_t> firsts;
+    int64_t sum = 0;
+
+    const bool complete = reader.forEachSlab(4, [&](Tensor<int>& slab, const uint64_t first){
+
+        firsts.push_back(first);
+        EXPECT_EQ(slab.getDimensionSizes(), (LinearContainer<uint64_t>{std::min<uint64_t>(4, 10 - first), 3, 4}));
+        EXPECT_EQ(slab.getItem({0, 0, 0}), static_cast<int>(first * 12));
+
+        slab.forEach([](int& item){ item *= 2; });
+        for(uint64_t i = 0; i < slab.getNumberOfItems(); ++i){
+            sum += slab.getData()[i];
+        }
+    });
+
+    EXPECT_TRUE(complete);
+    EXPECT_EQ(firsts, (std::vector<uint64_t>{0, 4, 8}));
+    EXPECT_EQ(sum, 2 * (119 * 120 / 2));
+
+    const auto slab = reader.readSlab(8, 5);
+    ASSERT_TRUE(slab.has_value());
+    EXPECT_EQ(*slab, makeSlab(8, 2));
+    EXPECT_FALSE(reader.readSlab(10, 1).has_value());
+
+    std::filesystem::remove(path);
+}
@@ -1,253 +0,0 @@
-#include <bitset>
-#include <iostream>
-#include <memory>
-#include <vector>
-
-#include <gtest/gtest.h>
-
-#include "core/Tensor.hpp"
-#include "TestUtils.hpp"
-
-using gema::Tensor;
-using gema::LinearContainer;
-
-constexpr uint64_t globalMultiplier = 1;
-
-
-
-constexpr uint64_t constructionMultiplier = 16 * 16 * globalMultiplier;
-
-TEST(tensor_stress_test, construction_001){
-
-    const LinearContainer<uint64_t> dimensionSizes{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2};
-
-    const uint64_t loopCount = (constructionMultiplier);
-    for(uint64_t i = 0; i < loopCount; i++){
-        Tensor<int> tensor = Tensor<int>(dimensionSizes);
-        doNotOptimizeAway(&i);
-    }
-}
-
-TEST(tensor_stress_test, construction_001_control){
-
-    const LinearContainer<uint64_t> dimensionSizes{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2};
-
-    const uint64_t loopCount = (constructionMultiplier);
-    for(uint64_t i = 0; i < loopCount; i++){
-        //Tensor<int> tensor = Tensor<int>(dimensionSizes);
-        doNotOptimizeAway(&i);
-    }
-}
-
-TEST(tensor_stress_test, construction_002){
-
-    const LinearContainer<uint64_t> dimensionSizes{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2};
-
-    const uint64_t loopCount = (constructionMultiplier);
-    for(uint64_t i = 0; i < loopCount; i++){
-        Tensor<int> tensor = Tensor<int>(dimensionSizes);
-        doNotOptimizeAway(&i);
-    }
-}
-
-TEST(tensor_stress_test, construction_002_control){
-
-    const LinearContainer<uint64_t> dimensionSizes{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2};
-
-    const uint64_t loopCount = (constructionMultiplier);
-    for(uint64_t i = 0; i < loopCount; i++){
-        //Tensor<int> tensor = Tensor<int>(dimensionSizes);
-        doNotOptimizeAway(&i);
-    }
-}
-
-TEST(tensor_stress_test, construction_003){
-
-    const LinearContainer<uint64_t> dimensionSizes{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2};
-
-    const uint64_t loopCount = (constructionMultiplier);
-    for(uint64_t i = 0; i < loopCount; i++){
-        Tensor<int> tensor = Tensor<int>(dimensionSizes);
-        doNotOptimizeAway(&i);
-    }
-}
-
-TEST(tensor_stress_test, construction_003_control){
-
-    const LinearContainer<uint64_t> dimensionSizes{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2};
-
-    const uint64_t loopCount = (constructionMultiplier);
-    for(uint64_t i = 0; i < loopCount; i++){
-        //Tensor<int> tensor = Tensor<int>(dimensionSizes);
-        doNotOptimizeAway(&i);
-    }
-}
-
-TEST(tensor_stress_test, construction_004){
-
-    const LinearContainer<uint64_t> dimensionSizes{256 * 256};
-
-    const uint64_t loopCount = (constructionMultiplier);
-    for(uint64_t i = 0; i < loopCount; i++){
-        Tensor<int> tensor = Tensor<int>(dimensionSizes);
-        doNotOptimizeAway(&i);
-    }
-}
-
-TEST(tensor_stress_test, construction_004_control){
-
-    const LinearContainer<uint64_t> dimensionSizes{256 * 256};
-
-    const uint64_t loopCount = (constructionMultiplier);
-    for(uint64_t i = 0; i < loopCount; i++){
-        //Tensor<int> tensor = Tensor<int>(dimensionSizes);
-        doNotOptimizeAway(&i);
-    }
-}
-
-TEST(tensor_stress_test, construction_005){
-
-    const LinearContainer<uint64_t> dimensionSizes{256 * 256 * 2};
-
-    const uint64_t loopCount = (constructionMultiplier);
-    for(uint64_t i = 0; i < loopCount; i++){
-        Tensor<int> tensor = Tensor<int>(dimensionSizes);
-        doNotOptimizeAway(&i);
-    }
-}
-
-TEST(tensor_stress_test, construction_005_control){
-
-    const LinearContainer<uint64_t> dimensionSizes{256 * 256 * 2};
-
-    const uint64_t loopCount = (constructionMultiplier);
-    for(uint64_t i = 0; i < loopCount; i++){
-        //Tensor<int> tensor = Tensor<int>(dimensionSizes);
-        doNotOptimizeAway(&i);
-    }
-}
-
-TEST(tensor_stress_test, construction_006){
-
-    const LinearContainer<uint64_t> dimensionSizes{256 * 256 * 4};
-
-    const uint64_t loopCount = (constructionMultiplier);
-    for(uint64_t i = 0; i < loopCount; i++){
-        Tensor<int> tensor = Tensor<int>(dimensionSizes);
-        doNotOptimizeAway(&i);
-    }
-}
-
-TEST(tensor_stress_test, construction_006_control){
-
-    const LinearContainer<uint64_t> dimensionSizes{256 * 256 * 4};
-
-    const uint64_t loopCount = (constructionMultiplier);
-    for(uint64_t i = 0; i < loopCount; i++){
-        //Tensor<int> tensor = Tensor<int>(dimensionSizes);
-        doNotOptimizeAway(&i);
-    }
-}
-
-
-
-
-constexpr uint64_t getItemMultiplier = 256 * 256 * 16 * globalMultiplier;
-
-TEST(tensor_stress_test, getItem_001){
-
-    const LinearContainer<uint64_t> dimensionSizes{256, 256, 256};
-    const uint64_t numberOfDimensions = dimensionSizes.size();
-    const uint64_t loopCount = (getItemMultiplier);
-
-    Tensor<int> tensor = Tensor<int>(dimensionSizes);
-
-    LinearContainer<uint64_t> currentCoords = {0, 0, 0};
-    uint64_t i = 0;
-    for(; i < loopCount; i++){
-        
-        tensor.getItem(currentCoords);
-
-        if(i == loopCount - 1) break;
-
-        Tensor<int>::incrementCoords(currentCoords, dimensionSizes);
-    }
-}
-
-TEST(tensor_stress_test, getItem_001_control){
-
-    const LinearContainer<uint64_t> dimensionSizes{256, 256, 256};
-    const uint64_t numberOfDimensions = dimensionSizes.size();
-    const uint64_t loopCount = (getItemMultiplier);
-
-    Tensor<int> tensor = Tensor<int>(dimensionSizes);
-
-    LinearContainer<uint64_t> currentCoords = {0, 0, 0};
-    for(uint64_t i = 0; i < loopCount; i++){
-        
-        //tensor.getItem(currentCoords);
-
-        if(i == loopCount - 1) break;
-
-        Tensor<int>::incrementCoords(currentCoords, dimensionSizes);
-    }
-}
-
-TEST(tensor_stress_test, getItem_002){
-
-    const LinearContainer<uint64_t> dimensionSizes{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2};
-    const uint64_t numberOfDimensions = dimensionSizes.size();
-    const uint64_t loopCount = (getItemMultiplier);
-
-    Tensor<int> tensor = Tensor<int>(dimensionSizes);
-
-    LinearContainer<uint64_t> currentCoords = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-    uint64_t i = 0;
-    for(; i < loopCount; i++){
-        
-        tensor.getItem(currentCoords);
-
-        if(i == loopCount - 1) break;
-
-        Tensor<int>::incrementCoords(currentCoords, dimensionSizes);
-    }
-}
-
-TEST(tensor_stress_test, getItem_002_control){
-
-    const LinearContainer<uint64_t> dimensionSizes{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2};
-    const uint64_t numberOfDimensions = dimensionSizes.size();
-    const uint64_t loopCount = (getItemMultiplier);
-
-    Tensor<int> tensor = Tensor<int>(dimensionSizes);
-
-    LinearContainer<uint64_t> currentCoords = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-    for(uint64_t i = 0; i < loopCount; i++){
-        
-        //tensor.getItem(currentCoords);
-
-        if(i == loopCount - 1) break;
-
-        Tensor<int>::incrementCoords(currentCoords, dimensionSizes);
-    }
-}
-
-
-
-
-constexpr uint64_t transpositionMultiplier = 256 * 256 * 16 * globalMultiplier;
-
-TEST(tensor_stress_test, transposition_001){
-
-    const LinearContainer<uint64_t> dimensionSizes{256, 256, 256};
-    const uint64_t numberOfDimensions = dimensionSizes.size();
-    const uint64_t loopCount = transpositionMultiplier;
-
-    Tensor<int> tensor = Tensor<int>(dimensionSizes);
-
-    uint64_t i = 0;
-    for(; i < loopCount; i++){
-        
-        //tensor.transposition();
-    }
-}
\ No newline at end of file
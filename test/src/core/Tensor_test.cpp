@@ -1,5 +1,6 @@
 #include <bitset>
 #include <memory>
+#include <stdexcept>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -12,6 +13,7 @@
 
 using gema::Tensor;
 using gema::LinearContainer;
+using gema::ExecutionPolicy;
 
 // Formatter specializations for certain used types
 namespace std{
@@ -207,6 +209,35 @@ TEST(tensor_test, constructor_010){
     delete tenVal2;
 }
 
+TEST(tensor_test, constructor_011){
+
+    // Dimension sizes of the first tensor fit inside of it, those of the second one do not
+    const LinearContainer<uint64_t> smallSizes{2, 3, 4};
+    const LinearContainer<uint64_t> bigSizes{1, 2, 1, 1, 2, 1, 1, 2, 1, 3};
+
+    Tensor<int> small(smallSizes);
+    Tensor<int> big(bigSizes);
+    small.fillWith(1);
+    big.fillWith(2);
+
+    Tensor<int> smallCopy = small;
+    Tensor<int> bigCopy = big;
+
+    std::swap(small, big);
+
+    EXPECT_EQ(small, bigCopy);
+    EXPECT_EQ(big, smallCopy);
+    EXPECT_EQ(small.getDimensionSizes(), bigSizes);
+    EXPECT_EQ(big.getDimensionSizes(), smallSizes);
+
+    Tensor<int> moved = std::move(big);
+    big = std::move(small);
+
+    EXPECT_EQ(moved, smallCopy);
+    EXPECT_EQ(big, bigCopy);
+    EXPECT_EQ(big.getItem({0, 1, 0, 0, 1, 0, 0, 1, 0, 2}), 2);
+}
+
 TEST(tensor_test, setItem_001){
 
     const LinearContainer<uint64_t> dimensionSizes{2, 3};
@@ -465,6 +496,61 @@ TEST(tensor_test, transposition_002){
     EXPECT_EQ(tensor, expected);
 }
 
+TEST(tensor_test, transposition_003){
+
+    const LinearContainer<uint64_t> dimensionSizes{3, 70, 5, 90};
+
+    auto tensor = Tensor<int>(dimensionSizes);
+    auto transposed = Tensor<int>(dimensionSizes);
+
+    int value = 0;
+    tensor.forEach([&value](int& item){
+        item = value++;
+    });
+    transposed = tensor;
+
+    // Non-adjacent dimensions given in reverse order, with tiles cut on both edges
+    transposed.transposition(3, 1);
+    Tensor<int> returned = tensor.transpositionAndReturn(1, 3);
+
+    const LinearContainer<uint64_t> expectedDimensionSizes{3, 90, 5, 70};
+    EXPECT_EQ(transposed.getDimensionSizes(), expectedDimensionSizes);
+
+    bool allMatch = true;
+    for(uint64_t a = 0; a < 3; ++a){
+        for(uint64_t i = 0; i < 70; ++i){
+            for(uint64_t b = 0; b < 5; ++b){
+                for(uint64_t j = 0; j < 90; ++j){
+                    const int original = tensor.getItem(std::array<uint64_t, 4>{a, i, b, j});
+                    allMatch &= (transposed.getItem(std::array<uint64_t, 4>{a, j, b, i}) == original);
+                }
+            }
+        }
+    }
+
+    EXPECT_TRUE(allMatch);
+    EXPECT_EQ(returned, transposed);
+}
+
+TEST(tensor_test, transposition_004){
+
+    const LinearContainer<uint64_t> dimensionSizes{512, 384};
+
+    auto tensor = Tensor<float>(dimensionSizes);
+    
+    float value = 0;
+    tensor.forEach([&value](float& item){
+        item = value++;
+    });
+
+    // Large enough to be split between threads
+    Tensor<float> transposed = tensor.transpositionAndReturn();
+    transposed.transposition();
+
+    EXPECT_EQ(transposed, tensor);
+    EXPECT_EQ(tensor.transpositionAndReturn().getItem(std::array<uint64_t, 2>{383, 1}), 1 * 384 + 383);
+}
+
 TEST(tensor_test, resize_001){
 
 
@@ -2439,6 +2525,122 @@ TEST(tensor_test, forEach_003){
     EXPECT_EQ(tensor, expected);
 }
 
+TEST(tensor_test, forEach_004){
+
+    // Item count that does not split evenly into cache lines or threads
+    const uint64_t itemCount = (1 << 20) + 13;
+    const LinearContainer<uint64_t> dimensionSizes{itemCount};
+
+    auto tensor = Tensor<int>(dimensionSizes);
+    tensor.fillWith(2);
+
+    tensor.forEach([](int& item){
+        item = item * 3 + 1;
+    }, ExecutionPolicy::parallel);
+
+    const Tensor<float> result = tensor.forEachAndReturn([](const int& item){
+        return static_cast<float>(item) / 2;
+    }, ExecutionPolicy::parallel);
+
+    const Tensor<int> sum = Tensor<int>::applyAndReturn(tensor, 1, [](const int& item, const int& value){
+        return item - value;
+    }, ExecutionPolicy::parallel);
+
+    Tensor<int> tensor2 = tensor;
+    tensor2 += tensor;
+    tensor2 = tensor2 * 2 + tensor;
+
+    for(uint64_t i = 0; i < itemCount; ++i){
+        ASSERT_EQ(tensor.getData()[i], 7);
+        ASSERT_EQ(result.getData()[i], 3.5f);
+        ASSERT_EQ(sum.getData()[i], 6);
+        ASSERT_EQ(tensor2.getData()[i], 35);
+    }
+}
+
+TEST(tensor_test, forEachWithCoords_001){
+
+    const LinearContainer<uint64_t> dimensionSizes{3, 4, 5};
+
+    auto tensor = Tensor<int>(dimensionSizes);
+    tensor.forEachWithCoords([](int& item, gema::span_view<uint64_t> coords){
+        item = static_cast<int>(coords[0] * 100 + coords[1] * 10 + coords[2]);
+    });
+
+    for(uint64_t i = 0; i < tensor.getNumberOfItems(); ++i){
+        const LinearContainer<uint64_t> coords = tensor.getCoords(i);
+        EXPECT_EQ(tensor.getData()[i], static_cast<int>(coords[0] * 100 + coords[1] * 10 + coords[2]));
+    }
+
+    // Only items of the box are visited, with coordinates of the whole tensor
+    int visited = 0;
+    EXPECT_TRUE(tensor.forEachWithCoords([&visited](int& item, gema::span_view<uint64_t> coords){
+        EXPECT_EQ(item, static_cast<int>(coords[0] * 100 + coords[1] * 10 + coords[2]));
+        item = -1;
+        ++visited;
+    }, {1, 1, 2}, {3, 3, 5}));
+
+    EXPECT_EQ(visited, 2 * 2 * 3);
+    EXPECT_EQ(tensor.getItem({1, 1, 2}), -1);
+    EXPECT_EQ(tensor.getItem({2, 2, 4}), -1);
+    EXPECT_EQ(tensor.getItem({1, 1, 1}), 111);
+    EXPECT_EQ(tensor.getItem({1, 3, 2}), 132);
+
+    // Empty box does nothing, box out of the tensor is refused
+    EXPECT_TRUE(tensor.forEachWithCoords([](int& item, gema::span_view<uint64_t>){ item = 0; }, {1, 2, 3}, {1, 4, 5}));
+    EXPECT_FALSE(tensor.forEachWithCoords([](int& item, gema::span_view<uint64_t>){ item = 0; }, {0, 0, 0}, {3, 5, 5}));
+    EXPECT_FALSE(tensor.forEachWithCoords([](int& item, gema::span_view<uint64_t>){ item = 0; }, {0, 0}, {3, 4}));
+    EXPECT_EQ(tensor.getItem({0, 0, 0}), 0);
+    EXPECT_EQ(tensor.getItem({2, 3, 4}), 234);
+}
+
+TEST(tensor_test, forEachWithCoords_002){
+
+    // Chunks of threads start in the middle of rows
+    const LinearContainer<uint64_t> dimensionSizes{37, 41, 29};
+
+    auto tensor = Tensor<uint64_t>(dimensionSizes);
+    tensor.forEachWithCoords([](uint64_t& item, gema::span_view<uint64_t> coords){
+        item = (coords[0] * 41 + coords[1]) * 29 + coords[2];
+    }, ExecutionPolicy::parallel);
+
+    for(uint64_t i = 0; i < tensor.getNumberOfItems(); ++i){
+        ASSERT_EQ(tensor.getData()[i], i);
+    }
+
+    tensor.forEachWithCoords([](uint64_t& item, gema::span_view<uint64_t> coords){
+        item = coords[1];
+    }, {5, 3, 0}, {30, 40, 29}, ExecutionPolicy::parallel);
+
+    for(uint64_t i = 0; i < tensor.getNumberOfItems(); ++i){
+        const LinearContainer<uint64_t> coords = tensor.getCoords(i);
+        const bool inBox = coords[0] >= 5 && coords[0] < 30 && coords[1] >= 3 && coords[1] < 40;
+        ASSERT_EQ(tensor.getData()[i], inBox ? coords[1] : i);
+    }
+}
+
+TEST(tensor_test, forEachWithCoords_003){
+
+    // Tensor without dimensions has one item at empty coordinates
+    auto tensor = Tensor<int>(LinearContainer<uint64_t>{});
+    tensor.fillWith(4);
+
+    for(const ExecutionPolicy policy : {ExecutionPolicy::sequential, ExecutionPolicy::parallel}){
+
+        uint64_t calls = 0;
+        tensor.forEachWithCoords([&calls](int& item, gema::span_view<uint64_t> coords){
+            ++calls;
+            item += static_cast<int>(coords.size()) + 1;
+        }, policy);
+
+        EXPECT_EQ(calls, 1);
+    }
+
+    EXPECT_EQ(tensor.getData()[0], 6);
+    EXPECT_TRUE(tensor.forEachWithCoords([](int& item, gema::span_view<uint64_t>){ item = 0; }, {}, {}));
+    EXPECT_EQ(tensor.getData()[0], 0);
+}
+
 
 TEST(tensor_test, getCoords_001){
 
@@ -2486,6 +2688,294 @@ TEST(tensor_test, getIndex_001){
     
 }
 
+TEST(tensor_test, operatorChain_001){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
+
+    auto tensor = Tensor<int>(dimensionSizes);
+    tensor.setData({1, 2, 3, 4, 5, 6});
+
+    auto tensor2 = Tensor<int>(dimensionSizes);
+    tensor2.setData({2, 0, -1, 3, 1, -2});
+
+    auto tensor3 = Tensor<int>(dimensionSizes);
+    tensor3.setData({1, 1, 1, 1, 1, 1});
+
+    auto tensor4 = Tensor<int>(dimensionSizes);
+    tensor4.setData({0, 1, 2, 3, 4, 5});
+
+    auto expected = Tensor<int>(dimensionSizes);
+    expected.setData({3, 0, -4, 10, 2, -16});
+
+    Tensor<int> result = tensor * tensor2 + tensor3 - tensor4;
+
+    EXPECT_EQ(result, expected);
+}
+
+TEST(tensor_test, operatorChain_002){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
+
+    auto tensor = Tensor<int>(dimensionSizes);
+    tensor.setData({1, 2, 3, 4, 5, 6});
+
+    auto tensor2 = Tensor<int>(dimensionSizes);
+    tensor2.setData({2, 0, -1, 3, 1, -2});
+
+    auto expected = Tensor<int>(dimensionSizes);
+    expected.setData({6, 6, 5, -1, -1, 0});
+
+    Tensor<int> result = -(tensor * 2) + 10 - tensor2;
+
+    EXPECT_EQ(result, expected);
+
+    // Expression reading the tensor it is assigned to
+    expected.setData({3, 4, 8, 19, 26, 34});
+
+    tensor = tensor * tensor + tensor2;
+
+    EXPECT_EQ(tensor, expected);
+}
+
+TEST(tensor_test, operatorChain_003){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
+
+    auto tensor = Tensor<int>(dimensionSizes);
+    tensor.setData({1, 2, 3, 4, 5, 6});
+
+    auto tensor2 = Tensor<int>(dimensionSizes);
+    tensor2.setData({2, 0, -1, 3, 1, -2});
+
+    auto tensor3 = Tensor<int>(dimensionSizes);
+    tensor3.setData({1, 1, 1, 1, 1, 1});
+
+    auto expected = Tensor<int>(dimensionSizes);
+    expected.setData({3, 2, 2, 7, 6, 4});
+
+    tensor += tensor2 * tensor3;
+
+    EXPECT_EQ(tensor, expected);
+}
+
+TEST(tensor_test, operatorChain_004){
+
+    // Odd item count, so there are items after the last whole pack
+    const uint64_t itemCount = 1037;
+    const LinearContainer<uint64_t> dimensionSizes{itemCount};
+
+    auto ints = Tensor<int>(dimensionSizes);
+    auto ints2 = Tensor<int>(dimensionSizes);
+    auto floats = Tensor<float>(dimensionSizes);
+    auto doubles = Tensor<double>(dimensionSizes);
+
+    for(uint64_t i = 0; i < itemCount; ++i){
+        ints.getData()[i] = static_cast<int>(i) - 500;
+        ints2.getData()[i] = static_cast<int>(i % 7) + 1;
+        floats.getData()[i] = static_cast<float>(i) * 0.5f;
+        doubles.getData()[i] = static_cast<double>(i) - 0.25;
+    }
+
+    const Tensor<int> intResult = ((ints << 2) ^ ints2) / ints2 - (ints >> 1) + (ints & 12) * 3 - ~ints % ints2;
+    const Tensor<float> floatResult = -floats * 2.0f + floats / 4.0f - 1.0f;
+    const Tensor<double> doubleResult = (doubles - 1.0) * doubles / 2.0;
+
+    for(uint64_t i = 0; i < itemCount; ++i){
+        const int a = ints.getData()[i];
+        const int b = ints2.getData()[i];
+        const float f = floats.getData()[i];
+        const double d = doubles.getData()[i];
+
+        ASSERT_EQ(intResult.getData()[i], ((a << 2) ^ b) / b - (a >> 1) + (a & 12) * 3 - ~a % b);
+        ASSERT_EQ(floatResult.getData()[i], -f * 2.0f + f / 4.0f - 1.0f);
+        ASSERT_EQ(doubleResult.getData()[i], (d - 1.0) * d / 2.0);
+    }
+
+    // Expression reading the tensor it is assigned to, starting out of pack alignment
+    const Tensor<float> original = floats;
+    floats = floats * floats + 1.0f;
+
+    for(uint64_t i = 0; i < itemCount; ++i){
+        const float f = original.getData()[i];
+        ASSERT_EQ(floats.getData()[i], f * f + 1.0f);
+    }
+}
+
+TEST(tensor_test, operatorChain_005){
+
+    auto tensor = Tensor<int>(LinearContainer<uint64_t>{2, 3});
+    tensor.setData({1, 2, 3, 4, 5, 6});
+
+    auto transposed = Tensor<int>(LinearContainer<uint64_t>{3, 2});
+    transposed.setData({1, 1, 1, 1, 1, 1});
+
+    // Same number of items, but different shape is refused
+    EXPECT_THROW(Tensor<int> result = tensor + transposed, std::invalid_argument);
+    EXPECT_THROW(tensor = tensor + transposed, std::invalid_argument);
+
+    // Assigned tensor takes shape of the expression, even if the number of items is the same
+    transposed = tensor * 2;
+    EXPECT_EQ(transposed.getDimensionSizes()[0], 2);
+    EXPECT_EQ(transposed.getDimensionSizes()[1], 3);
+    EXPECT_EQ(transposed.getItem({1, 2}), 12);
+}
+
+TEST(tensor_test, reduce_001){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
+
+    auto tensor = Tensor<int>(dimensionSizes);
+    tensor.setData({1, -2, 3, 4, 5, -6});
+
+    EXPECT_EQ(tensor.reduce(std::plus<int>(), 10), 15);
+    EXPECT_EQ(tensor.reduce([](const int& a, const int& b){ return std::min(a, b); }, 0), -6);
+    EXPECT_EQ(tensor.reduce([](const int& a, const int& b){ return std::max(std::abs(a), std::abs(b)); }, 0), 6);
+}
+
+TEST(tensor_test, reduce_002){
+
+    const LinearContainer<uint64_t> dimensionSizes{3, 100000};
+
+    auto tensor = Tensor<int64_t>(dimensionSizes);
+    tensor.fillWith(2);
+
+    EXPECT_EQ(tensor.reduce(std::plus<int64_t>(), 0), 600000);
+}
+
+TEST(tensor_test, reduce_003){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
+
+    auto tensor = Tensor<int>(dimensionSizes);
+    tensor.setData({1, -2, 3, 4, 5, -6});
+
+    auto tensor2 = tensor;
+
+    auto expected = Tensor<int>({3});
+    expected.setData({6, 4, -2});
+
+    tensor.reduce(0, std::plus<int>(), 1);
+
+    EXPECT_EQ(tensor, expected);
+
+    auto expected2 = Tensor<int>({2});
+    expected2.setData({2, 3});
+
+    tensor2.reduce(1, std::plus<int>(), 0);
+
+    EXPECT_EQ(tensor2, expected2);
+}
+
+TEST(tensor_test, reduce_004){
+
+    // Operations keeping one of the operands are associative, but not commutative, so items have to be combined in order
+    for(const uint64_t itemCount : {1, 2, 15, 16, 17, 1000, 65537, 1000003}){
+
+        LinearContainer<int> items(itemCount);
+        for(uint64_t i = 0; i < itemCount; ++i){
+            items[i] = static_cast<int>(i);
+        }
+
+        auto tensor = Tensor<int>({itemCount});
+        tensor.setData(items);
+
+        EXPECT_EQ(tensor.reduce([](const int&, const int& b){ return b; }, -1), static_cast<int>(itemCount - 1));
+        EXPECT_EQ(tensor.reduce([](const int& a, const int&){ return a; }, -1), -1);
+    }
+}
+
+TEST(tensor_test, collapseDimension_001){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
+
+    auto tensor = Tensor<int>(dimensionSizes);
+    tensor.setData({1, -2, 3, 4, 5, -6});
+
+    auto expected = Tensor<int>({2});
+    expected.setData({-6, -120});
+
+    tensor.collapseDimension(1, [](int& accumulated, const int& item){
+        accumulated *= item;
+    });
+
+    EXPECT_EQ(tensor, expected);
+}
+
+TEST(tensor_test, view_001){
+
+    const LinearContainer<uint64_t> dimensionSizes{3, 4};
+
+    auto tensor = Tensor<int>(dimensionSizes);
+    tensor.setData({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+
+    auto block = tensor.view().slice({1, 1}, {3, 3});
+
+    EXPECT_EQ(block.getNumberOfItems(), 4);
+    EXPECT_EQ(block.getItem({1, 0}), 9);
+    EXPECT_FALSE(block.isContiguous());
+
+    // Writes go into the viewed tensor
+    block.forEach([](int& item){
+        item = -item;
+    });
+
+    auto expected = Tensor<int>(dimensionSizes);
+    expected.setData({0, 1, 2, 3, 4, -5, -6, 7, 8, -9, -10, 11});
+
+    EXPECT_EQ(tensor, expected);
+
+    auto expectedRow = Tensor<int>({4});
+    expectedRow.setData({8, -9, -10, 11});
+
+    EXPECT_EQ(tensor.view().select(0, 2).materialize(), expectedRow);
+}
+
+TEST(tensor_test, view_002){
+
+    const LinearContainer<uint64_t> dimensionSizes{2, 3};
+
+    auto tensor = Tensor<int>(dimensionSizes);
+    tensor.setData({0, 5, -1, 100, -2, -16});
+
+    const Tensor<int>& constTensor = tensor;
+    auto transposed = constTensor.view().permute({1, 0});
+
+    EXPECT_EQ(transposed.materialize(), tensor.transpositionAndReturn());
+    EXPECT_TRUE(tensor.view().isContiguous());
+    EXPECT_EQ(transposed.reduce([](const int& a, const int& b){ return a + b; }, 0), 86);
+}
+
+TEST(tensor_test, view_003){
+
+    auto tensor = Tensor<int>({2, 3});
+    tensor.setData({1, 2, 3, 4, 5, 6});
+
+    auto row = Tensor<int>({1, 3});
+    row.setData({10, 20, 30});
+
+    // Row repeated over both rows of tensor, without copying it
+    tensor.view().apply(row.view().broadcast({2, 3}), [](int& a, const int& b){
+        a += b;
+    });
+
+    auto expected = Tensor<int>({2, 3});
+    expected.setData({11, 22, 33, 14, 25, 36});
+
+    EXPECT_EQ(tensor, expected);
+
+    auto squeezed = row.view().squeeze();
+    EXPECT_EQ(squeezed.getNumberOfDimensions(), 1);
+    EXPECT_EQ(squeezed.getItem({2}), 30);
+
+    auto broadcasted = row.view().squeeze(0).broadcast({2, 2, 3});
+    auto sums = broadcasted.applyAndReturn(tensor.view().broadcast({2, 2, 3}), [](const int& a, const int& b){
+        return a + b;
+    });
+
+    EXPECT_EQ(sums.getNumberOfItems(), 12);
+    EXPECT_EQ(sums.getItem({1, 1, 2}), 66);
+}
+
 TEST(tensor_test, showDebug){
 
     const LinearContainer<uint64_t> dimensionSizes{2, 3};
@@ -0,0 +1,100 @@
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+
+#include "core/TransferUSM.hpp"
+#include "core/TensorParallel.hpp"
+
+using gema::TransferUSM;
+using gema::MemoryPoolUSM;
+using gema::TensorParallel;
+using gema::LinearContainer;
+
+TEST(transferusm_test, upload_001){
+
+    sycl::queue queue{sycl::property::queue::in_order{}};
+
+    constexpr uint64_t count = 1000;
+    constexpr uint64_t chunkBytes = 256;
+
+    std::vector<int> source(count);
+    for(uint64_t i = 0; i < count; ++i){
+        source[i] = static_cast<int>(i);
+    }
+
+    int* device = sycl::malloc_device<int>(count, queue);
+    const uint64_t stagingInUse = MemoryPoolUSM::getPool(&queue, sycl::usm::alloc::host).getStatistics().bytesInUse;
+
+    // Every chunk is doubled by kernel as soon as it is uploaded
+    std::vector<uint64_t> firsts;
+    std::vector<sycl::event> kernels;
+
+    sycl::event uploaded = TransferUSM::upload(queue, device, source.data(), count, sycl::event(), 
+    [&](const sycl::event& chunkCopied, const uint64_t firstItem, const uint64_t itemCount){
+
+        firsts.push_back(firstItem);
+        EXPECT_EQ(itemCount, std::min<uint64_t>(64, count - firstItem));
+
+        kernels.push_back(queue.submit([&](sycl::handler& h){
+            h.depends_on(chunkCopied);
+            h.parallel_for(sycl::range<1>(itemCount), [=](sycl::id<1> idx){
+                device[firstItem + idx[0]] *= 2;
+            });
+        }));
+    }, chunkBytes);
+
+    uploaded.wait();
+    sycl::event::wait(kernels);
+
+    EXPECT_EQ(firsts.size(), 16);
+    EXPECT_EQ(firsts.back(), 960);
+    EXPECT_EQ(MemoryPoolUSM::getPool(&queue, sycl::usm::alloc::host).getStatistics().bytesInUse, stagingInUse);
+
+    // Download by chunks gets the doubled items back in order
+    std::vector<int> destination(count);
+    uint64_t nextFirst = 0;
+
+    TransferUSM::download(queue, destination.data(), device, count, sycl::event(), 
+    [&](const uint64_t firstItem, const uint64_t itemCount){
+
+        EXPECT_EQ(firstItem, nextFirst);
+        EXPECT_EQ(destination[firstItem + itemCount - 1], static_cast<int>(2 * (firstItem + itemCount - 1)));
+        nextFirst = firstItem + itemCount;
+    }, chunkBytes);
+
+    EXPECT_EQ(nextFirst, count);
+    for(uint64_t i = 0; i < count; ++i){
+        EXPECT_EQ(destination[i], static_cast<int>(2 * i));
+    }
+
+    sycl::free(device, queue);
+}
+
+TEST(transferusm_test, tensorParallel_001){
+
+    // Tensor bigger than one chunk goes through staging both ways
+    const uint64_t side = 1200;
+    const uint64_t count = side * side;
+
+    LinearContainer<float> items(count);
+    for(uint64_t i = 0; i < count; ++i){
+        items[i] = static_cast<float>(i % 1000);
+    }
+
+    TensorParallel<float> tensor(LinearContainer<uint64_t>{side, side}, items);
+    tensor.forEach([](float& item){ item += 1.0f; });
+
+    const LinearContainer<float> copied = tensor.getTensor().getDataContainer().copyToBackend(gema::MemoryBackend<float>());
+    ASSERT_EQ(copied.size(), count);
+    for(uint64_t i = 0; i < count; i += 997){
+        EXPECT_EQ(copied[i], static_cast<float>(i % 1000) + 1.0f);
+    }
+    EXPECT_EQ(copied[count - 1], static_cast<float>((count - 1) % 1000) + 1.0f);
+
+    // Small tensor is copied directly and prints the same as before
+    const TensorParallel<int> small(LinearContainer<uint64_t>{2, 2}, LinearContainer<int>{1, 2, 3, 4});
+    EXPECT_EQ(small.toString(), "{{1, 2}, {3, 4}}");
+}